@@ -0,0 +1,188 @@
+///
+/// @file BWRY_Sweep.ino
+/// @brief Example of all orientations and colours, for golden images
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+///
+/// @see ReadMe.txt for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+#if (SCREEN_EPD_EXT3_RELEASE < 830)
+#error Required SCREEN_EPD_EXT3_RELEASE 830
+#endif // SCREEN_EPD_EXT3_RELEASE
+
+// Set parameters
+
+// Define structures and classes
+
+// Define variables and constants
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_154_QS_0F, boardRaspberryPiPico_RP2040);
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_213_QS_0F, boardRaspberryPiPico_RP2040);
+Screen_EPD_EXT3 myScreen(eScreen_EPD_266_QS_0F, boardRaspberryPiPico_RP2040);
+
+///
+/// @brief Basic and dithered colours
+///
+const uint16_t colours[] = {myColours.black, myColours.white, myColours.red, myColours.yellow,
+                            myColours.grey, myColours.darkRed, myColours.lightRed,
+                            myColours.darkYellow, myColours.lightYellow, myColours.orange
+                           };
+const uint8_t numberColours = sizeof(colours) / sizeof(colours[0]);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief One row per colour, one column per primitive
+/// @param orientation orientation, 0..3
+/// @note Points, lines, areas, circles, triangles and text, odd coordinates to check the dither phase
+///
+void displaySweep(uint8_t orientation)
+{
+    myScreen.setOrientation(orientation);
+    myScreen.clear(colours[(orientation * 3 + 4) % numberColours]);
+    myScreen.selectFont(Font_Terminal6x8);
+
+    uint16_t dx = myScreen.screenSizeX() / 7;
+    uint16_t dy = myScreen.screenSizeY() / numberColours;
+    uint16_t r = min(dx, dy) / 2 - 1;
+
+    for (uint8_t i = 0; i < numberColours; i++)
+    {
+        uint16_t colour = colours[i];
+        uint16_t back = colours[numberColours - 1 - i];
+        uint16_t x = 1;
+        uint16_t y = dy * i + (i % 2);
+
+        // Solid and outline rectangles
+        myScreen.setPenSolid(true);
+        myScreen.rectangle(x, y, x + dx - 2, y + dy - 2, colour);
+        x += dx;
+        myScreen.setPenSolid(false);
+        myScreen.rectangle(x, y, x + dx - 2, y + dy - 2, colour);
+        x += dx;
+
+        // Solid and outline circles
+        myScreen.setPenSolid(true);
+        myScreen.circle(x + dx / 2, y + dy / 2, r, colour);
+        x += dx;
+        myScreen.setPenSolid(false);
+        myScreen.circle(x + dx / 2, y + dy / 2, r, colour);
+        x += dx;
+
+        // Solid triangle and diagonal line
+        myScreen.setPenSolid(true);
+        myScreen.triangle(x, y + dy - 2, x + dx / 2, y, x + dx - 2, y + dy - 2, colour);
+        x += dx;
+        myScreen.line(x, y, x + dx - 2, y + dy - 2, colour);
+        x += dx;
+
+        // Points and text, solid font
+        for (uint16_t j = 0; j < dy - 1; j += 2)
+        {
+            myScreen.point(x + (j % dx), y + j, colour);
+        }
+        myScreen.setFontSolid(true);
+        myScreen.gText(x + 2, y, formatString("%i", i), colour, back);
+    }
+
+    myScreen.flush();
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.print("begin... ");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    for (uint8_t orientation = 0; orientation < 4; orientation++)
+    {
+        mySerial.println(formatString("Orientation %i... ", orientation));
+        displaySweep(orientation);
+        wait(4);
+    }
+
+    mySerial.println("Invert... ");
+    myScreen.invert(true);
+    displaySweep(ORIENTATION_LANDSCAPE);
+    myScreen.invert(false);
+    wait(4);
+
+    mySerial.print("White... ");
+    myScreen.clear();
+    myScreen.flush();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
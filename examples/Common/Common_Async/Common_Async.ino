@@ -0,0 +1,152 @@
+///
+/// @file Common_Async.ino
+/// @brief Example of asynchronous update with double frame-buffer
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#ifndef WITH_DOUBLE_BUFFER
+#define WITH_DOUBLE_BUFFER 1 ///< 1 = double frame-buffer, 0 = single frame-buffer
+#endif // WITH_DOUBLE_BUFFER
+
+#define NUMBER_FRAMES 4 ///< number of frames
+#define DURATION_RENDER 8000 ///< duration of the application work per frame, ms
+
+// Define structures and classes
+
+// Define constants and variables
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_154_QS_0F, boardRaspberryPiPico_RP2040);
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_213_QS_0F, boardRaspberryPiPico_RP2040);
+Screen_EPD_EXT3 myScreen(eScreen_EPD_266_QS_0F, boardRaspberryPiPico_RP2040);
+
+volatile uint8_t countUpdates = 0;
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Callback at the end of the update
+/// @note Update mode as parameter, not used
+///
+void updated(uint8_t)
+{
+    countUpdates += 1;
+}
+
+// Functions
+///
+/// @brief Render one frame
+/// @param frame frame number
+/// @note Application work, as reading sensors, simulated with a wait
+///
+void render(uint8_t frame)
+{
+    uint32_t chrono = millis();
+
+    myScreen.clear();
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(8, 8, formatString("Frame %i", frame));
+    myScreen.setPenSolid(true);
+    myScreen.rectangle(8, 32, 8 + 16 * (frame + 1), 48, myColours.red);
+
+    // Application work, with the update running in the background
+    while (millis() - chrono < DURATION_RENDER)
+    {
+        myScreen.isBusy();
+        delay(100);
+    }
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+#if (WITH_DOUBLE_BUFFER == 1)
+    myScreen.setDoubleBuffer();
+#endif // WITH_DOUBLE_BUFFER
+    myScreen.begin();
+    myScreen.setFlushCallback(updated);
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println(formatString("Frames with %s frame-buffer... ", (WITH_DOUBLE_BUFFER == 1) ? "double" : "single"));
+    uint32_t chrono = millis();
+    for (uint8_t frame = 0; frame < NUMBER_FRAMES; frame++)
+    {
+#if (WITH_DOUBLE_BUFFER == 1)
+        // Double frame-buffer: draw during the update, then wait for its end
+        render(frame);
+        while (myScreen.isBusy())
+        {
+            delay(100);
+        }
+#else
+        // Single frame-buffer: wait for the end of the update, then draw
+        while (myScreen.isBusy())
+        {
+            delay(100);
+        }
+        render(frame);
+#endif // WITH_DOUBLE_BUFFER
+
+        myScreen.flushAsync();
+    }
+
+    while (myScreen.isBusy())
+    {
+        delay(100);
+    }
+    chrono = millis() - chrono;
+
+    mySerial.println(formatString("%i updates in %i ms, %i ms per frame", countUpdates, chrono, chrono / NUMBER_FRAMES));
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
@@ -0,0 +1,115 @@
+///
+/// @file Common_Bands.ino
+/// @brief Example of banded rendering with a small band buffer
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define BAND_ROWS 32 ///< number of rows per band, even
+
+// Define structures and classes
+
+// Define constants and variables
+// #define MY_SCREEN eScreen_EPD_154_QS_0F
+// #define MY_SCREEN eScreen_EPD_213_QS_0F
+#define MY_SCREEN eScreen_EPD_266_QS_0F
+// #define MY_SCREEN eScreen_EPD_417_QS_0A
+
+Screen_EPD_EXT3 myScreen(MY_SCREEN, boardRaspberryPiPico_RP2040);
+
+///
+/// @brief Band buffer, BAND_ROWS rows of the frame-buffer
+///
+uint8_t band[BAND_ROWS * screenSizeH_EPD_EXT3(MY_SCREEN) / 4];
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Draw the whole scene
+/// @note Called once per band, drawing clipped to the band
+///
+void draw()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    myScreen.clear();
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(8, 8, "Banded rendering");
+    myScreen.gText(8, 32, formatString("%i bytes", sizeof(band)), myColours.red);
+    myScreen.gText(8, 56, formatString("instead of %i", Screen_EPD_EXT3::requiredBufferSize(MY_SCREEN)), myColours.yellow);
+
+    myScreen.setPenSolid(true);
+    myScreen.rectangle(x / 2, y / 2, x - 8, y - 8, myColours.orange);
+    myScreen.setPenSolid(false);
+    myScreen.circle(x / 4, y * 3 / 4, min(x, y) / 6, myColours.black);
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+    myScreen.setBandBuffer(band, sizeof(band));
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println(formatString("Bands of %i rows, %i bytes... ", BAND_ROWS, sizeof(band)));
+    uint32_t chrono = millis();
+    myScreen.flushBands(draw);
+    chrono = millis() - chrono;
+    mySerial.println(formatString("%24s %8i ms", "flushBands()", chrono));
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
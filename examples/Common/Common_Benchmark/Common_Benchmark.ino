@@ -0,0 +1,477 @@
+///
+/// @file Common_Benchmark.ino
+/// @brief Protocol for benchmark of the frame-buffer primitives
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+/// Release 830: Added SPI bus
+/// Release 830: Added OTP cache
+/// Release 830: Added deferred begin
+/// Release 830: Added statistics for update
+/// Release 830: Added text
+/// Release 830: Added glyph cache
+/// Release 830: Added scaled text
+/// Release 830: Added triangles
+/// Release 830: Added circles, ellipses and rounded rectangles
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define BENCHMARK_LOOPS 8 ///< number of iterations per measure
+#define GLYPH_CACHE_SIZE 4096 ///< bytes for the glyph cache
+#define GAUGE_SEGMENTS 128 ///< triangles per gauge
+
+// Define structures and classes
+
+// Define constants and variables
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_154_QS_0F, boardRaspberryPiPico_RP2040);
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_213_QS_0F, boardRaspberryPiPico_RP2040);
+Screen_EPD_EXT3 myScreen(eScreen_EPD_266_QS_0F, boardRaspberryPiPico_RP2040);
+
+uint8_t glyphCache[GLYPH_CACHE_SIZE];
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Display one result
+/// @param label name of the measure
+/// @param chrono total duration, us
+///
+void report(const char * label, uint32_t chrono)
+{
+    mySerial.println(formatString("%24s %8i us", label, chrono / BENCHMARK_LOOPS));
+}
+
+// Functions
+///
+/// @brief Fill the screen point by point
+/// @param colour 16-bit colour
+///
+void fillPoints(uint16_t colour)
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    for (uint16_t i = 0; i < x; i++)
+    {
+        for (uint16_t j = 0; j < y; j++)
+        {
+            myScreen.point(i, j, colour);
+        }
+    }
+}
+
+///
+/// @brief Perform the benchmark of the frame-buffer primitives
+///
+void performBenchmark()
+{
+    uint32_t chrono;
+    uint16_t colours[] = { myColours.black, myColours.red, myColours.grey, myColours.orange };
+
+    for (uint8_t orientation = 0; orientation < 4; orientation++)
+    {
+        myScreen.setOrientation(orientation);
+        uint16_t x = myScreen.screenSizeX();
+        uint16_t y = myScreen.screenSizeY();
+        mySerial.println(formatString("Orientation %i, %ix%i", orientation, x, y));
+
+        for (uint8_t c = 0; c < 4; c++)
+        {
+            uint16_t colour = colours[c];
+            mySerial.println(formatString("Colour 0x%04x", colour));
+
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                fillPoints(colour);
+            }
+            chrono = micros() - chrono;
+            report("point() full screen", chrono);
+
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                myScreen.setPenSolid(true);
+                myScreen.rectangle(0, 0, x - 1, y - 1, colour);
+            }
+            chrono = micros() - chrono;
+            report("rectangle() full screen", chrono);
+
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                for (uint16_t j = 0; j < y; j++)
+                {
+                    myScreen.line(0, j, x - 1, j, colour);
+                }
+            }
+            chrono = micros() - chrono;
+            report("line() horizontal", chrono);
+
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                for (uint16_t j = 0; j < x; j++)
+                {
+                    myScreen.line(j, 0, j, y - 1, colour);
+                }
+            }
+            chrono = micros() - chrono;
+            report("line() vertical", chrono);
+
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                myScreen.clear(colour);
+            }
+            chrono = micros() - chrono;
+            report("clear()", chrono);
+        }
+    }
+
+    myScreen.setPenSolid(false);
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.clear();
+}
+
+///
+/// @brief Perform the benchmark of the text
+/// @details Characters per second for each font, transparent and solid background
+///
+void performText()
+{
+    uint32_t chrono;
+    const char * text = "0123456789ABCDEF";
+    uint32_t number = strlen(text) * BENCHMARK_LOOPS;
+    uint32_t hits, misses;
+
+    for (uint8_t cached = 0; cached < 2; cached++)
+    {
+        myScreen.setGlyphCache((cached == 1) ? glyphCache : 0, sizeof(glyphCache));
+
+        for (uint8_t font = 0; font < myScreen.fontMax(); font++)
+        {
+            myScreen.selectFont(font);
+            uint16_t y = myScreen.screenSizeY() - myScreen.characterSizeY();
+
+            for (uint8_t solid = 0; solid < 2; solid++)
+            {
+                myScreen.setFontSolid(solid == 1);
+
+                chrono = micros();
+                for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+                {
+                    myScreen.gText(i % 4, (i * 8) % y, text, myColours.black, myColours.yellow);
+                }
+                chrono = micros() - chrono;
+
+                String label = formatString("gText() font %i%s%s", font, (solid == 1) ? " solid" : "", (cached == 1) ? " cache" : "");
+                report(label.c_str(), chrono);
+                mySerial.println(formatString("%24s %8i chars/s", "", (uint32_t)((uint64_t)number * 1000000 / max(chrono, (uint32_t)1))));
+            }
+        }
+    }
+
+    myScreen.getGlyphCacheCounters(hits, misses);
+    mySerial.println(formatString("%24s %8i hits %8i misses", "Glyph cache", hits, misses));
+    myScreen.setGlyphCache(0, 0);
+
+    myScreen.setFontSolid(false);
+    myScreen.clear();
+}
+
+///
+/// @brief Perform the benchmark of the scaled text
+/// @details Large numeric read-out, gTextLarge() against gTextScaled()
+///
+void performTextScaled()
+{
+    uint32_t chrono;
+    const char * text = "12:34";
+    uint32_t number = strlen(text) * BENCHMARK_LOOPS;
+
+    myScreen.selectFont(myScreen.fontMax() - 1);
+
+    for (uint8_t solid = 0; solid < 2; solid++)
+    {
+        myScreen.setFontSolid(solid == 1);
+
+        for (uint8_t scaled = 0; scaled < 2; scaled++)
+        {
+            chrono = micros();
+            for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+            {
+                if (scaled == 1)
+                {
+                    myScreen.gTextScaled(i % 4, 0, text, 2, 2, myColours.black, myColours.yellow);
+                }
+                else
+                {
+                    myScreen.gTextLarge(i % 4, 0, text, myColours.black, myColours.yellow);
+                }
+            }
+            chrono = micros() - chrono;
+
+            String label = formatString("%s%s", (scaled == 1) ? "gTextScaled() x2" : "gTextLarge()", (solid == 1) ? " solid" : "");
+            report(label.c_str(), chrono);
+            mySerial.println(formatString("%24s %8i chars/s", "", (uint32_t)((uint64_t)number * 1000000 / max(chrono, (uint32_t)1))));
+        }
+    }
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        myScreen.gTextScaled(i % 4, 0, text, 3, 4, myColours.black, myColours.yellow);
+    }
+    chrono = micros() - chrono;
+    report("gTextScaled() x3y4 solid", chrono);
+
+    myScreen.setFontSolid(false);
+    myScreen.clear();
+}
+
+///
+/// @brief Perform the benchmark of the triangles
+/// @details Gauge of GAUGE_SEGMENTS solid triangles around the centre, alternate colours
+///
+void performTriangle()
+{
+    uint32_t chrono;
+    uint16_t x[GAUGE_SEGMENTS + 1];
+    uint16_t y[GAUGE_SEGMENTS + 1];
+    uint16_t x0 = myScreen.screenSizeX() / 2;
+    uint16_t y0 = myScreen.screenSizeY() / 2;
+    uint16_t radius = min(x0, y0) - 1;
+    uint32_t number = (uint32_t)GAUGE_SEGMENTS * BENCHMARK_LOOPS;
+
+    for (uint16_t i = 0; i <= GAUGE_SEGMENTS; i++)
+    {
+        float angle = 2.0 * PI * i / GAUGE_SEGMENTS;
+        x[i] = x0 + (int16_t)(radius * cos(angle));
+        y[i] = y0 + (int16_t)(radius * sin(angle));
+    }
+
+    myScreen.setPenSolid(true);
+    chrono = micros();
+    for (uint8_t j = 0; j < BENCHMARK_LOOPS; j++)
+    {
+        for (uint16_t i = 0; i < GAUGE_SEGMENTS; i++)
+        {
+            myScreen.triangle(x0, y0, x[i], y[i], x[i + 1], y[i + 1], (i % 2) ? myColours.red : myColours.yellow);
+        }
+    }
+    chrono = micros() - chrono;
+    myScreen.setPenSolid(false);
+
+    report(formatString("triangle() gauge x%i", GAUGE_SEGMENTS).c_str(), chrono);
+    mySerial.println(formatString("%24s %8i triangles/s", "", (uint32_t)((uint64_t)number * 1000000 / max(chrono, (uint32_t)1))));
+
+    myScreen.clear();
+}
+
+///
+/// @brief Perform the benchmark of the rounded forms
+/// @details Largest solid circle, ellipse and rounded rectangle
+///
+void performRound()
+{
+    uint32_t chrono;
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t radius = min(x, y) / 2 - 1;
+
+    myScreen.setPenSolid(true);
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        myScreen.circle(x / 2, y / 2, radius, (i % 2) ? myColours.red : myColours.yellow);
+    }
+    chrono = micros() - chrono;
+    report("circle() solid", chrono);
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        myScreen.ellipse(x / 2, y / 2, x / 2 - 1, y / 2 - 1, (i % 2) ? myColours.red : myColours.yellow);
+    }
+    chrono = micros() - chrono;
+    report("ellipse() solid", chrono);
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        myScreen.roundRectangle(0, 0, x - 1, y - 1, radius / 2, (i % 2) ? myColours.red : myColours.yellow);
+    }
+    chrono = micros() - chrono;
+    report("roundRectangle() solid", chrono);
+
+    myScreen.setPenSolid(false);
+    myScreen.clear();
+}
+
+///
+/// @brief Perform the benchmark of the SPI bus
+/// @note Panel not selected, data ignored by the panel
+///
+void performSPI()
+{
+    uint32_t chrono;
+    uint8_t buffer[1024];
+    memset(buffer, 0x55, sizeof(buffer));
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        for (uint16_t j = 0; j < sizeof(buffer); j++)
+        {
+            hV_HAL_SPI_transfer(buffer[j]);
+        }
+    }
+    chrono = micros() - chrono;
+    report("SPI byte per byte", chrono);
+    mySerial.println(formatString("%24s %8i bytes/s", "", (uint32_t)((uint64_t)sizeof(buffer) * BENCHMARK_LOOPS * 1000000 / max(chrono, (uint32_t)1))));
+
+    chrono = micros();
+    for (uint8_t i = 0; i < BENCHMARK_LOOPS; i++)
+    {
+        hV_HAL_SPI_transferBlock(buffer, sizeof(buffer));
+    }
+    chrono = micros() - chrono;
+    report("SPI block", chrono);
+    mySerial.println(formatString("%24s %8i bytes/s", "", (uint32_t)((uint64_t)sizeof(buffer) * BENCHMARK_LOOPS * 1000000 / max(chrono, (uint32_t)1))));
+}
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+///
+/// @brief Trace one step of the update
+/// @param step FLUSH_* step
+/// @param duration duration of the step, us
+///
+void trace(uint8_t step, uint32_t duration)
+{
+    mySerial.println(formatString("%24s %8i us", formatString("step %i", step).c_str(), duration));
+}
+
+///
+/// @brief Perform the benchmark of the update
+/// @note Requires DEBUG_MODE = USE_DEBUG_STATS
+///
+void performUpdate()
+{
+    myScreen.setFlushTrace(trace);
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(8, 8, "Statistics");
+    myScreen.flush();
+    myScreen.setFlushTrace(0); // nullptr
+
+    const flushStats_s & stats = myScreen.getFlushStats();
+    mySerial.println(formatString("%24s %8i", "update", stats.count));
+    mySerial.println(formatString("%24s %8i us", "resume()", stats.resume));
+    mySerial.println(formatString("%24s %8i us", "initial", stats.initial));
+    mySerial.println(formatString("%24s %8i us", "send image", stats.send));
+    mySerial.println(formatString("%24s %8i us", "refresh", stats.refresh));
+    mySerial.println(formatString("%24s %8i us", "power off", stats.powerOff));
+    mySerial.println(formatString("%24s %8i us", "total", stats.total));
+    mySerial.println(formatString("%24s %8i bytes", "SPI", stats.bytes));
+    mySerial.println(formatString("%24s %8i polls", "busy", stats.polls));
+}
+#endif // DEBUG_MODE
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+    // Frame-buffer ready for drawing, panel bring-up deferred to first update
+    uint32_t chrono = micros();
+    myScreen.beginLazy();
+    chrono = micros() - chrono;
+    mySerial.println(formatString("beginLazy() %i us", chrono));
+
+    chrono = micros();
+    myScreen.begin();
+    chrono = micros() - chrono;
+    mySerial.println(formatString("begin() %i us", chrono));
+
+    // Second begin() with OTP table from cache, no 3-wire SPI read
+    // Cache to be saved in RTC RAM, EEPROM or file for next cold boot
+    uint8_t cacheOTP[SCREEN_EPD_EXT3_OTP_CACHE_SIZE];
+    uint16_t sizeOTP = myScreen.exportOTP(cacheOTP, sizeof(cacheOTP));
+    myScreen.importOTP(cacheOTP, sizeOTP);
+    chrono = micros();
+    myScreen.begin();
+    chrono = micros() - chrono;
+    mySerial.println(formatString("begin() with OTP cache of %i bytes %i us", sizeOTP, chrono));
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println("Benchmark... ");
+    performBenchmark();
+
+    mySerial.println("Text... ");
+    performText();
+    performTextScaled();
+
+    mySerial.println("Triangles... ");
+    performTriangle();
+
+    mySerial.println("Rounded forms... ");
+    performRound();
+
+    mySerial.println("SPI... ");
+    performSPI();
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    mySerial.println("Update... ");
+    performUpdate();
+#endif // DEBUG_MODE
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
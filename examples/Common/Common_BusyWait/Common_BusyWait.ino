@@ -0,0 +1,162 @@
+///
+/// @file Common_BusyWait.ino
+/// @brief Example of busy wait strategies
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_SAMPLES 64 ///< number of busy periods per strategy, Linux host only
+
+// Define structures and classes
+
+// Define constants and variables
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_154_QS_0F, boardRaspberryPiPico_RP2040);
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_213_QS_0F, boardRaspberryPiPico_RP2040);
+Screen_EPD_EXT3 myScreen(eScreen_EPD_266_QS_0F, boardRaspberryPiPico_RP2040);
+
+const uint8_t strategies[] = {BUSY_WAIT_POLL, BUSY_WAIT_INTERRUPT, BUSY_WAIT_YIELD};
+const char * names[] = {"poll", "interrupt", "yield"};
+
+// Prototypes
+
+// Utilities
+
+// Functions
+#if defined(hV_HAL_LINUX)
+///
+/// @brief Latency distribution of each strategy
+/// @details Latency between the end of the busy period and the return of waitFor()
+/// @note Linux host only, with busy periods of the virtual panel
+///
+void performLatency()
+{
+    uint32_t latency[NUMBER_SAMPLES];
+    uint8_t pin = myScreen.getBoardPins().panelBusy;
+
+    mySerial.println(formatString("%24s %8s %8s %8s %8s %8s", "", "min", "median", "mean", "max", "reads"));
+
+    for (uint8_t strategy = 0; strategy < sizeof(strategies); strategy++)
+    {
+        uint64_t total = 0;
+        uint32_t reads = 0;
+
+        for (uint16_t sample = 0; sample < NUMBER_SAMPLES; sample++)
+        {
+            // Busy period from 20 to 120 ms, not aligned on ms
+            delayMicroseconds((sample * 397) % 1000);
+            myVirtualPanel.setBusy(20 + (sample * 37) % 100);
+
+            reads += waitFor(pin, HIGH, strategies[strategy]);
+            latency[sample] = (uint32_t)(hV_HAL_Linux_getTime() - myVirtualPanel.getBusyUntil());
+            total += latency[sample];
+        }
+
+        // Insertion sort for the median
+        for (uint16_t i = 1; i < NUMBER_SAMPLES; i++)
+        {
+            uint32_t value = latency[i];
+            uint16_t j = i;
+            while ((j > 0) and (latency[j - 1] > value))
+            {
+                latency[j] = latency[j - 1];
+                j--;
+            }
+            latency[j] = value;
+        }
+
+        mySerial.println(formatString("%24s %8i %8i %8i %8i %8i", names[strategy], latency[0], latency[NUMBER_SAMPLES / 2], (uint32_t)(total / NUMBER_SAMPLES), latency[NUMBER_SAMPLES - 1], reads / NUMBER_SAMPLES));
+    }
+    mySerial.println(formatString("%24s %8s %8s %8s %8s %8s", "", "us", "us", "us", "us", "/wait"));
+}
+#endif // hV_HAL_LINUX
+
+///
+/// @brief Duration of a full update with each strategy
+///
+void performUpdate()
+{
+    myScreen.selectFont(Font_Terminal12x16);
+
+    for (uint8_t strategy = 0; strategy < sizeof(strategies); strategy++)
+    {
+        myScreen.setBusyWait(strategies[strategy]);
+
+        myScreen.clear();
+        myScreen.gText(8, 8, formatString("Busy wait %s", names[strategy]));
+
+        uint32_t chrono = millis();
+        myScreen.flush();
+        chrono = millis() - chrono;
+
+        mySerial.println(formatString("%24s %8i ms", names[strategy], chrono));
+    }
+
+    myScreen.setBusyWait(BUSY_WAIT_POLL);
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+#if defined(hV_HAL_LINUX)
+    mySerial.println("Latency... ");
+    performLatency();
+#endif // hV_HAL_LINUX
+
+    mySerial.println("Update... ");
+    performUpdate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
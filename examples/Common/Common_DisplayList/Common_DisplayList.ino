@@ -0,0 +1,143 @@
+///
+/// @file Common_DisplayList.ino
+/// @brief Example of display list with deferred rasterisation
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define BAND_ROWS 32 ///< number of rows per band, even
+#define LIST_SIZE 1024 ///< size of the display list, in bytes
+
+// Define structures and classes
+
+// Define constants and variables
+// #define MY_SCREEN eScreen_EPD_154_QS_0F
+// #define MY_SCREEN eScreen_EPD_213_QS_0F
+#define MY_SCREEN eScreen_EPD_266_QS_0F
+// #define MY_SCREEN eScreen_EPD_417_QS_0A
+
+Screen_EPD_EXT3 myScreen(MY_SCREEN, boardRaspberryPiPico_RP2040);
+
+///
+/// @brief Band buffer, BAND_ROWS rows of the frame-buffer
+///
+uint8_t band[BAND_ROWS * screenSizeH_EPD_EXT3(MY_SCREEN) / 4];
+
+///
+/// @brief Display list, commands replayed for each band
+///
+uint8_t list[LIST_SIZE];
+
+///
+/// @brief Handle of the value field
+///
+uint32_t field;
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Record the whole scene
+/// @note Drawing functions record commands, nothing is rasterised yet
+///
+void record()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    myScreen.clear();
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(8, 8, "Display list", myColours.red);
+
+    myScreen.setFontSolid(true);
+    myScreen.gText(8, 40, "00000", myColours.black, myColours.white);
+    field = myScreen.getDisplayListLast();
+    myScreen.setFontSolid(false);
+
+    myScreen.setPenSolid(true);
+    myScreen.rectangle(x / 2, y / 2, x - 8, y - 8, myColours.orange);
+    myScreen.triangle(8, y - 8, x / 4, y / 2, x / 2 - 8, y - 8, myColours.yellow);
+    myScreen.setPenSolid(false);
+    myScreen.circle(x * 3 / 4, y * 3 / 4, min(x, y) / 8, myColours.black);
+    myScreen.line(0, 0, x - 1, y - 1, myColours.black);
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+    myScreen.setBandBuffer(band, sizeof(band));
+    myScreen.setDisplayList(list, sizeof(list));
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    record();
+
+    uint16_t count;
+    uint32_t used;
+    myScreen.getDisplayListSize(count, used);
+    mySerial.println(formatString("%24s %8i commands %8i bytes", "Display list", count, used));
+
+    for (uint8_t i = 1; i < 4; i++)
+    {
+        myScreen.setDisplayListText(field, formatString("%5i", i * 12345 % 100000));
+
+        uint32_t chrono = millis();
+        myScreen.flush();
+        chrono = millis() - chrono;
+        mySerial.println(formatString("%24s %8i ms", "flush()", chrono));
+    }
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
@@ -88,7 +88,7 @@ void displayWhoAmI()
     y += dy;
     myScreen.gText(x, y, formatString("Size %i x %i", myScreen.screenSizeX(), myScreen.screenSizeY()));
     y += dy;
-    myScreen.gText(x, y, formatString("Number %s", myScreen.screenNumber()));
+    myScreen.gText(x, y, formatString("Number %s", myScreen.screenNumber().c_str()));
     y += dy;
     myScreen.gText(x, y, formatString("PDLS %s v%i.%i.%i", SCREEN_EPD_EXT3_VARIANT, SCREEN_EPD_EXT3_RELEASE / 100, (SCREEN_EPD_EXT3_RELEASE / 10) % 10, SCREEN_EPD_EXT3_RELEASE % 10));
     y += dy;
@@ -0,0 +1,143 @@
+///
+/// @file Common_Widgets.ino
+/// @brief Example of retained widgets with damage tracking
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_BWRY.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_WIDGETS 4 ///< number of widgets
+#define NUMBER_SAMPLES 6 ///< number of samples
+
+// Define structures and classes
+
+// Define constants and variables
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_154_QS_0F, boardRaspberryPiPico_RP2040);
+// Screen_EPD_EXT3 myScreen(eScreen_EPD_213_QS_0F, boardRaspberryPiPico_RP2040);
+Screen_EPD_EXT3 myScreen(eScreen_EPD_266_QS_0F, boardRaspberryPiPico_RP2040);
+
+hV_Widgets myWidgets(&myScreen);
+widget_s widgets[NUMBER_WIDGETS];
+
+///
+/// @brief Icon, two frames of 8x8 pixels
+///
+const uint8_t iconAlarm[] = {0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, // off
+                             0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c  // on
+                            };
+
+uint8_t labelUnit, numberTemperature, barTemperature, iconStatus;
+
+///
+/// @brief Samples, last ones identical
+///
+const int16_t samples[NUMBER_SAMPLES] = {215, 218, 256, 256, 301, 301};
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Static template and widgets
+///
+void displayTemplate()
+{
+    myScreen.clear();
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(8, 8, "Widgets", myColours.red);
+    myScreen.setPenSolid(false);
+    myScreen.rectangle(4, 4, myScreen.screenSizeX() - 5, myScreen.screenSizeY() - 5, myColours.black);
+
+    myWidgets.begin(widgets, NUMBER_WIDGETS);
+    numberTemperature = myWidgets.addNumber(8, 40, 5, 1);
+    labelUnit = myWidgets.addLabel(8 + 6 * myScreen.characterSizeX(), 40, "oC", 2, myColours.red);
+    barTemperature = myWidgets.addBar(8, 64, myScreen.screenSizeX() - 9, 79, 0, 400, myColours.black);
+    iconStatus = myWidgets.addIcon(myScreen.screenSizeX() - 20, 8, 8, 8, iconAlarm, 2, myColours.red);
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    mySerial.println("begin... ");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println("Template... ");
+    displayTemplate();
+
+    mySerial.println("Samples... ");
+    uint16_t x1, y1, x2, y2;
+    for (uint8_t sample = 0; sample < NUMBER_SAMPLES; sample++)
+    {
+        myWidgets.setValue(numberTemperature, samples[sample]);
+        myWidgets.setValue(barTemperature, samples[sample]);
+        myWidgets.setValue(iconStatus, (samples[sample] > 300) ? 1 : 0);
+
+        uint32_t chrono = millis();
+        if (myWidgets.update(x1, y1, x2, y2))
+        {
+            myScreen.flush();
+            chrono = millis() - chrono;
+            mySerial.println(formatString("%8i damage %3i %3i %3i %3i %8i ms", samples[sample], x1, y1, x2, y2, chrono));
+        }
+        else
+        {
+            mySerial.println(formatString("%8i unchanged, flush() skipped", samples[sample]));
+        }
+    }
+
+    uint32_t drawn, skipped;
+    myWidgets.getWidgetsCounters(drawn, skipped);
+    mySerial.println(formatString("%24s %8i drawn %8i skipped", "Widgets", drawn, skipped));
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
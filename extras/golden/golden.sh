@@ -0,0 +1,188 @@
+#!/bin/sh
+#
+# @file golden.sh
+# @brief Golden-image suite for the emulated panel
+#
+# @details Project Pervasive Displays Library Suite
+# @n Based on highView technology
+#
+# @author Rei Vilo
+# @date 17 Oct 2026
+# @version 830
+#
+# @copyright (c) Rei Vilo, 2010-2026
+# @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+#
+# Builds each example of examples/Common and examples/BWRY with -DhV_HAL_LINUX
+# for the 154, 213, 266 and 417 panels, runs it and compares each refresh with
+# the reference images of references/<panel>/<example>_NNN.ppm.gz
+#
+# Builds with -Wall -Wextra and fails on any warning other than the #warning
+# lines of hV_Screen_Buffer.h and the known warnings of warnings.txt
+#
+# Usage
+#   extras/golden/golden.sh              compare, exit 1 on any difference
+#   extras/golden/golden.sh --update     regenerate the reference images
+#
+# Environment
+#   CXX       compiler, default g++
+#   PANELS    panels, default "154 213 266 417"
+#   EXAMPLES  examples, default all of examples/Common and examples/BWRY
+#
+# Release 830: First release
+#
+
+set -u
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$HERE/../.." && pwd)
+REFERENCES="$HERE/references"
+
+CXX=${CXX:-g++}
+PANELS=${PANELS:-"154 213 266 417"}
+EXAMPLES=${EXAMPLES:-$(ls -d "$ROOT"/examples/Common/*/ "$ROOT"/examples/BWRY/*/ | xargs -n 1 basename)}
+FLAGS="-Wall -Wextra -std=gnu++11 -O2 -DhV_HAL_LINUX -I$ROOT/src"
+
+# Virtual time only, for measures displayed on screen
+hV_HAL_LINUX_CLOCK=virtual
+export hV_HAL_LINUX_CLOCK
+
+UPDATE=0
+if [ "${1:-}" = "--update" ]
+then
+    UPDATE=1
+fi
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Known warnings, without comments
+grep -v "^#" "$HERE/warnings.txt" > "$WORK/warnings.txt"
+
+# New warnings of a build log, file name and message without line number
+warnings()
+{
+    grep "warning:" "$1" \
+        | sed -e 's|^.*/||' -e 's|:[0-9]*:[0-9]*:|:|' \
+        | grep -v "^hV_Screen_Buffer.h: warning: #warning " \
+        | grep -vxF -f "$WORK/warnings.txt"
+}
+
+# Screen of the example for the panel
+screen()
+{
+    case "$1" in
+        154) echo "eScreen_EPD_154_QS_0F" ;;
+        213) echo "eScreen_EPD_213_QS_0F" ;;
+        266) echo "eScreen_EPD_266_QS_0F" ;;
+        417) echo "eScreen_EPD_417_QS_0A" ;;
+        *) echo "hV * Panel $1 not supported" >&2; exit 2 ;;
+    esac
+}
+
+COUNT_PASS=0
+COUNT_FAIL=0
+
+for PANEL in $PANELS
+do
+    SCREEN=$(screen "$PANEL") || exit 2
+    mkdir -p "$WORK/$PANEL/objects"
+
+    # Library, once per panel
+    for SOURCE in "$ROOT"/src/*.cpp
+    do
+        OBJECT="$WORK/$PANEL/objects/$(basename "$SOURCE" .cpp).o"
+        if ! $CXX $FLAGS -DhV_HAL_LINUX_PANEL="$PANEL" -c "$SOURCE" -o "$OBJECT" 2> "$OBJECT.txt"
+        then
+            echo "hV * Build $PANEL $(basename "$SOURCE") failed"
+            sed -e 's/^/    /' "$OBJECT.txt"
+            exit 2
+        fi
+
+        NEW=$(warnings "$OBJECT.txt")
+        if [ -n "$NEW" ]
+        then
+            echo "FAIL $PANEL $(basename "$SOURCE") warnings"
+            echo "$NEW" | sed -e 's/^/    /'
+            COUNT_FAIL=$((COUNT_FAIL + 1))
+        fi
+    done
+
+    for EXAMPLE in $EXAMPLES
+    do
+        SKETCH=$(ls "$ROOT"/examples/*/"$EXAMPLE"/"$EXAMPLE".ino 2>/dev/null | head -n 1)
+        if [ -z "$SKETCH" ]
+        then
+            echo "hV * Example $EXAMPLE not found"
+            exit 2
+        fi
+
+        # Same example, screen of the panel on non-comment lines
+        RUN="$WORK/$PANEL/$EXAMPLE"
+        mkdir -p "$RUN/output" "$RUN/reference"
+        sed -e "/^[[:space:]]*\/\//!s/eScreen_EPD_[0-9A-Za-z_]*/$SCREEN/g" "$SKETCH" > "$RUN/$EXAMPLE.ino"
+
+        if ! $CXX $FLAGS -DhV_HAL_LINUX_PANEL="$PANEL" -x c++ "$RUN/$EXAMPLE.ino" -x none "$WORK/$PANEL"/objects/*.o -o "$RUN/$EXAMPLE" 2> "$RUN/build.txt"
+        then
+            echo "FAIL $PANEL $EXAMPLE build"
+            sed -e 's/^/    /' "$RUN/build.txt"
+            COUNT_FAIL=$((COUNT_FAIL + 1))
+            continue
+        fi
+
+        NEW=$(warnings "$RUN/build.txt")
+        if [ -n "$NEW" ]
+        then
+            echo "FAIL $PANEL $EXAMPLE warnings"
+            echo "$NEW" | sed -e 's/^/    /'
+            COUNT_FAIL=$((COUNT_FAIL + 1))
+            continue
+        fi
+
+        if [ $UPDATE -eq 1 ]
+        then
+            if ! (cd "$RUN" && hV_HAL_LINUX_SNAPSHOT="$RUN/output/$EXAMPLE" "./$EXAMPLE" > "$RUN/log.txt" 2>&1)
+            then
+                echo "FAIL $PANEL $EXAMPLE run"
+                COUNT_FAIL=$((COUNT_FAIL + 1))
+                continue
+            fi
+
+            mkdir -p "$REFERENCES/$PANEL"
+            rm -f "$REFERENCES/$PANEL/${EXAMPLE}"_[0-9][0-9][0-9].ppm.gz
+            FRAMES=0
+            for IMAGE in "$RUN/output"/*.ppm
+            do
+                [ -f "$IMAGE" ] || continue
+                gzip -9n -c "$IMAGE" > "$REFERENCES/$PANEL/$(basename "$IMAGE").gz"
+                FRAMES=$((FRAMES + 1))
+            done
+            echo "UPDATE $PANEL $EXAMPLE $FRAMES frames"
+            COUNT_PASS=$((COUNT_PASS + 1))
+            continue
+        fi
+
+        FRAMES=0
+        for ARCHIVE in "$REFERENCES/$PANEL/${EXAMPLE}"_[0-9][0-9][0-9].ppm.gz
+        do
+            [ -f "$ARCHIVE" ] || continue
+            gzip -dc "$ARCHIVE" > "$RUN/reference/$(basename "$ARCHIVE" .gz)"
+            FRAMES=$((FRAMES + 1))
+        done
+
+        # Same number of frames, each compared by the emulated panel
+        if (cd "$RUN" && hV_HAL_LINUX_SNAPSHOT="$RUN/output/$EXAMPLE" hV_HAL_LINUX_REFERENCE="$RUN/reference/$EXAMPLE" "./$EXAMPLE" > "$RUN/log.txt" 2>&1) \
+            && [ "$(ls "$RUN/output" | wc -l)" -eq $FRAMES ]
+        then
+            echo "PASS $PANEL $EXAMPLE $FRAMES frames"
+            COUNT_PASS=$((COUNT_PASS + 1))
+        else
+            echo "FAIL $PANEL $EXAMPLE $(ls "$RUN/output" | wc -l) of $FRAMES frames"
+            grep "hV \*" "$RUN/log.txt" | sed -e 's/^/    /'
+            COUNT_FAIL=$((COUNT_FAIL + 1))
+        fi
+    done
+done
+
+echo "$COUNT_PASS passed, $COUNT_FAIL failed"
+[ $COUNT_FAIL -eq 0 ]
@@ -6,8 +6,8 @@
 /// @n Based on highView technology
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -35,13 +35,14 @@
 ///
 
 // SDK
-#include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
 
 #ifndef PDLS_EXT3_BASIC_RELEASE
 ///
 /// @brief Library release number
 ///
-#define PDLS_EXT3_BASIC_RELEASE 812
+#define PDLS_EXT3_BASIC_RELEASE 830
 #include "Screen_EPD_EXT3.h"
+#include "hV_Widgets.h"
 #endif // PDLS_EXT3_BASIC_RELEASE
 
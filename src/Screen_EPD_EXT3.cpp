@@ -37,6 +37,27 @@
 // Release 805: Improved stability
 // Release 806: New library for Wide temperature only
 // Release 810: Added support for EXT4
+// Release 830: Added span fill for areas and clear
+// Release 830: Added colour descriptor for frame-buffer codes
+// Release 830: Folded orientation and addressing for points
+// Release 830: Added dirty area and skip of unchanged flush
+// Release 830: Added optional skip of identical frames
+// Release 830: Added asynchronous update
+// Release 830: Added optional double frame-buffer
+// Release 830: Added export and import of OTP table
+// Release 830: Added deferred panel bring-up
+// Release 830: Added statistics and trace for update
+// Release 830: Added fill with pattern
+// Release 830: Added screen fixed at compile time
+// Release 830: Added caller frame-buffer and end()
+// Release 830: Added banded rendering
+// Release 830: Added glyph columns for gText()
+// Release 830: Added glyph cache
+// Release 830: Added fast path for areas one pixel high, physical
+// Release 830: Added display list
+// Release 830: Changed dither phase of clear(), same as point()
+// Release 830: Added two-entry cache for colour descriptors
+// Release 830: Added fillPattern() to display list, replay only if changed
 //
 
 // Library header
@@ -64,32 +85,13 @@ void Screen_EPD_EXT3::COG_SmallQ_reset()
 void Screen_EPD_EXT3::COG_SmallQ_getDataOTP()
 {
     // 1.6 Read OTP memory mapping data
-    uint16_t _chipId;
+    uint16_t _chipId = 0;
     uint16_t _readBytes = 0;
     // uint8_t ui8 = 0; // dummy
     u_flagOTP = false;
 
     // Size cSize cType Driver
-    switch (u_eScreen_EPD)
-    {
-        case eScreen_EPD_154_QS_0F: // 1.54”
-        case eScreen_EPD_213_QS_0F: // 2.13”
-        case eScreen_EPD_266_QS_0F: // 2.66”
-
-            _chipId = 0x0302;
-            _readBytes = 48;
-            break;
-
-        case eScreen_EPD_417_QS_0A: // 4.17”
-
-            _chipId = 0x0605;
-            _readBytes = 112;
-            break;
-
-        default:
-
-            break;
-    }
+    COG_SmallQ_getTypeOTP(_chipId, _readBytes);
 
     // GPIO
     // s_reset();
@@ -260,6 +262,36 @@ void Screen_EPD_EXT3::COG_SmallQ_getDataOTP()
     u_flagOTP = true;
 }
 
+bool Screen_EPD_EXT3::COG_SmallQ_getTypeOTP(uint16_t & chipId, uint16_t & readBytes)
+{
+    bool result = true;
+
+    // Size cSize cType Driver
+    switch (s_getScreen())
+    {
+        case eScreen_EPD_154_QS_0F: // 1.54”
+        case eScreen_EPD_213_QS_0F: // 2.13”
+        case eScreen_EPD_266_QS_0F: // 2.66”
+
+            chipId = 0x0302;
+            readBytes = 48;
+            break;
+
+        case eScreen_EPD_417_QS_0A: // 4.17”
+
+            chipId = 0x0605;
+            readBytes = 112;
+            break;
+
+        default:
+
+            result = false;
+            break;
+    }
+
+    return result;
+}
+
 void Screen_EPD_EXT3::COG_SmallQ_initial()
 {
     // Application note § 3. COG initial
@@ -268,7 +300,7 @@ void Screen_EPD_EXT3::COG_SmallQ_initial()
     b_sendIndexData(0x00, &COG_data[17], 2); // PSR
     b_sendIndexData(0x03, &COG_data[30], 3); // PFS
 
-    switch (u_eScreen_EPD)
+    switch (s_getScreen())
     {
         case eScreen_EPD_417_QS_0A:
 
@@ -300,7 +332,7 @@ void Screen_EPD_EXT3::COG_SmallQ_initial()
     b_sendCommandData8(0xe7, COG_data[33]); //
     b_sendCommandData8(0xe3, COG_data[42]); // PWS
 
-    switch (u_eScreen_EPD)
+    switch (s_getScreen())
     {
         case eScreen_EPD_417_QS_0A:
 
@@ -318,13 +350,12 @@ void Screen_EPD_EXT3::COG_SmallQ_initial()
     b_sendCommandData8(0xe9, 0x01); //
     b_sendCommandData8(0x30, 0x08); // PLL
 
-    switch (u_eScreen_EPD)
+    switch (s_getScreen())
     {
         case eScreen_EPD_417_QS_0A:
 
             b_sendCommand8(0x04); // Power on
             digitalWrite(b_pin.panelCS, HIGH); // CS# = 1
-            b_waitBusy();
             break;
 
         default:
@@ -336,43 +367,70 @@ void Screen_EPD_EXT3::COG_SmallQ_initial()
 void Screen_EPD_EXT3::COG_SmallQ_sendImageData()
 {
     // Application note § 4. Input image to the EPD
-    b_sendIndexData(0x10, s_newImage, u_pageColourSize); // First frame, blackBuffer
+    if ((s_bandDraw == 0) and (s_bandRows == v_screenSizeV))
+    {
+        b_sendIndexData(0x10, s_sendImage, s_getPageSize()); // First frame, blackBuffer
+    }
+    else
+    {
+        // Banded rendering, each band drawn or replayed from the display list, then sent
+        b_sendCommand8(0x10); // First frame, blackBuffer
+        for (uint16_t row = 0; row < v_screenSizeV; row += s_bandHeight)
+        {
+            s_setBand(row);
+            if (s_bandDraw != 0)
+            {
+                s_bandDraw();
+            }
+            else
+            {
+                s_listReplay();
+            }
+            b_sendData(s_newImage, s_bandSize);
+        }
+        s_setBand(0);
+    }
 }
 
-void Screen_EPD_EXT3::COG_SmallQ_update()
+void Screen_EPD_EXT3::COG_SmallQ_powerOn()
 {
     // Application note § 5. Send updating command
-    switch (u_eScreen_EPD)
+    switch (s_getScreen())
     {
-        case eScreen_EPD_417_QS_0A:
+        case eScreen_EPD_417_QS_0A: // 0x04 sent with COG_SmallQ_initial()
 
             break;
 
         default: // All except 417: 0x04 after sending image
 
             b_sendCommand8(0x04); // Power on
-            b_waitBusy();
             break;
     }
+}
 
+void Screen_EPD_EXT3::COG_SmallQ_update()
+{
+    // Application note § 5. Send updating command
     b_sendCommandData8(0x12, 0x00); // Display Refresh
-    b_waitBusy();
 }
 
 void Screen_EPD_EXT3::COG_SmallQ_powerOff()
 {
     // Application note § 5. Turn-off DC/DC
     b_sendCommandData8(0x02, 0x00); // Turn off DC/DC
-    b_waitBusy();
+}
+
+uint32_t Screen_EPD_EXT3::COG_SmallQ_getRestoreDelay()
+{
+    uint32_t result = 0;
 
-    switch (u_eScreen_EPD)
+    switch (s_getScreen())
     {
         case eScreen_EPD_417_QS_0A:
 
             if (COG_data[43] == 0xff)
             {
-                delay(5000);
-                b_sendIndexData(0x00, &COG_data[26], 2); // PSR
+                result = 5000; // ms
             }
             break;
 
@@ -380,6 +438,16 @@ void Screen_EPD_EXT3::COG_SmallQ_powerOff()
 
             break;
     }
+
+    return result;
+}
+
+void Screen_EPD_EXT3::COG_SmallQ_restore()
+{
+    if (COG_SmallQ_getRestoreDelay() > 0)
+    {
+        b_sendIndexData(0x00, &COG_data[26], 2); // PSR
+    }
 }
 //
 // --- End of Small screens with Q film
@@ -397,10 +465,133 @@ Screen_EPD_EXT3::Screen_EPD_EXT3(eScreen_EPD_t eScreen_EPD_EXT3, pins_t board)
     u_eScreen_EPD = eScreen_EPD_EXT3;
     b_pin = board;
     s_newImage = 0; // nullptr
+    s_sendImage = 0; // nullptr
+    s_flagDoubleBuffer = false;
+    s_bufferImage = 0; // nullptr
+    s_bufferSize = 0;
+    s_flagBufferOwned = false;
     COG_data[0] = 0;
+
+    // No band until begin()
+    s_flagBand = false;
+    s_bandHeight = 0;
+    s_bandRow1 = 0;
+    s_bandRows = 0;
+    s_bandStart = 0;
+    s_bandSize = 0;
+    s_bandDraw = 0; // nullptr
+
+    // No pixel until begin() and setOrientation()
+    s_orientIndex0 = 0;
+    s_orientStepX = 0;
+    s_orientStepY = 0;
+    s_orientSizeX = 0;
+    s_orientSizeY = 0;
+    s_setDirty(false);
+
+    // Descriptors for black, not inverted, code 0b00
+    s_colour2bpp[0] = { 0x0000, false, true, 0b00, 0b00, 0b00000000, 0b00000000 };
+    s_colour2bpp[1] = s_colour2bpp[0];
+    s_colourLast = 0;
+
+    // No hash of identical frames
+    s_flagHash = false;
+    s_flagHashValid = false;
+    s_hash = 0;
+    s_hashSkipped = 0;
+    s_hashSent = 0;
+
+    // No glyph cache
+    memset(&s_glyphCache, 0x00, sizeof(s_glyphCache));
+
+    // No display list
+    s_listBuffer = 0; // nullptr
+    s_listSize = 0;
+    s_listState = LIST_OFF;
+    s_listInvert = false;
+    clearDisplayList();
+
+    // No asynchronous update
+    s_flushState = FLUSH_IDLE;
+    s_flushMode = UPDATE_NONE;
+    s_flagFlushAsync = false;
+    s_flushChrono = 0;
+    s_flushCallback = 0; // nullptr
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    memset(&s_stats, 0x00, sizeof(s_stats));
+    s_statsStep = FLUSH_IDLE;
+    s_statsChrono = 0;
+    s_statsStart = 0;
+    s_statsTrace = 0; // nullptr
+#endif // DEBUG_MODE
 }
 
 void Screen_EPD_EXT3::begin()
+{
+    beginLazy();
+
+    // Turn SPI on, initialise GPIOs and set GPIO levels
+    // Reset panel and get tables
+    resume();
+}
+
+void Screen_EPD_EXT3::end()
+{
+    // Complete the update in progress
+    if (s_flushState != FLUSH_IDLE)
+    {
+        s_flushStep(true);
+    }
+
+    suspend(POWER_SCOPE_GPIO_ONLY);
+
+    s_releaseBuffer();
+    s_newImage = 0; // nullptr
+    s_sendImage = 0; // nullptr
+}
+
+void Screen_EPD_EXT3::setFrameBuffer(uint8_t * buffer, uint32_t size)
+{
+    s_releaseBuffer();
+
+    s_bufferImage = buffer;
+    s_bufferSize = (buffer != 0) ? size : 0;
+    s_flagBufferOwned = false;
+    s_flagBand = false;
+}
+
+void Screen_EPD_EXT3::setBandBuffer(uint8_t * buffer, uint32_t size)
+{
+    setFrameBuffer(buffer, size);
+    s_flagBand = (buffer != 0);
+}
+
+void Screen_EPD_EXT3::s_setBand(uint16_t row1)
+{
+    s_bandRow1 = row1;
+    s_bandRows = min(s_bandHeight, (uint16_t)(v_screenSizeV - row1));
+    s_bandStart = (uint32_t)s_bandRow1 * u_bufferSizeH;
+    s_bandSize = (uint32_t)s_bandRows * u_bufferSizeH;
+}
+
+void Screen_EPD_EXT3::s_releaseBuffer()
+{
+    if (s_flagBufferOwned and (s_bufferImage != 0))
+    {
+#if defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
+        free(s_bufferImage);
+#else // default case
+        delete[] s_bufferImage;
+#endif // ESP32 BOARD_HAS_PSRAM
+    }
+
+    s_bufferImage = 0; // nullptr
+    s_bufferSize = 0;
+    s_flagBufferOwned = false;
+}
+
+void Screen_EPD_EXT3::beginLazy()
 {
     // u_eScreen_EPD = eScreen_EPD_EXT3;
     u_codeSize = SCREEN_SIZE(u_eScreen_EPD);
@@ -441,40 +632,24 @@ void Screen_EPD_EXT3::begin()
     // Configure board
     b_begin(b_pin, FAMILY_SMALL, 50);
 
-    // Sizes
-    switch (u_codeSize)
+#if defined(SCREEN_EPD_EXT3_FIXED)
+    if (u_eScreen_EPD != SCREEN_EPD_EXT3_FIXED)
     {
-        case SIZE_154: // 1.54"
-
-            v_screenSizeV = 152; // vertical = wide size
-            v_screenSizeH = 152; // horizontal = small size
-            break;
-
-        case SIZE_213: // 2.13"
-
-            v_screenSizeV = 212; // vertical = wide size
-            v_screenSizeH = 104; // horizontal = small size
-            break;
-
-        case SIZE_266: // 2.66"
-
-            v_screenSizeV = 296; // vertical = wide size
-            v_screenSizeH = 152; // horizontal = small size
-            break;
-
-        case SIZE_417: // 4.17"
-
-            v_screenSizeV = 300; // vertical = wide size
-            v_screenSizeH = 400; // horizontal = small size
-            break;
-
-        default:
+        mySerial.println();
+        mySerial.println(formatString("hV * Screen %i-%cS-0%c is not SCREEN_EPD_EXT3_FIXED", u_codeSize, u_codeFilm, u_codeDriver));
+        while (0x01);
+    }
+#endif // SCREEN_EPD_EXT3_FIXED
 
-            mySerial.println();
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver));
-            while (0x01);
-            break;
-    } // u_codeSize
+    // Sizes
+    v_screenSizeV = screenSizeV_EPD_EXT3(s_getScreen()); // vertical = wide size
+    v_screenSizeH = screenSizeH_EPD_EXT3(s_getScreen()); // horizontal = small size
+    if (v_screenSizeV == 0)
+    {
+        mySerial.println();
+        mySerial.println(formatString("hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver));
+        while (0x01);
+    }
     v_screenDiagonal = u_codeSize;
 
     // Report
@@ -484,7 +659,15 @@ void Screen_EPD_EXT3::begin()
     mySerial.println(formatString("hV = PDLS %s v%i.%i.%i", SCREEN_EPD_EXT3_VARIANT, SCREEN_EPD_EXT3_RELEASE / 100, (SCREEN_EPD_EXT3_RELEASE / 10) % 10, SCREEN_EPD_EXT3_RELEASE % 10));
     mySerial.println();
 
-    u_bufferDepth = 1; // 1 single buffer with 2 bits per pixel
+    u_bufferDepth = s_flagDoubleBuffer ? 2 : 1; // 1 single buffer with 2 bits per pixel, 2 with double frame-buffer
+#if defined(SCREEN_EPD_EXT3_FIXED)
+    if (u_bufferDepth > SCREEN_EPD_EXT3_FIXED_DEPTH)
+    {
+        mySerial.println("hV * Double frame-buffer requires SCREEN_EPD_EXT3_FIXED_DEPTH 2");
+        s_flagDoubleBuffer = false;
+        u_bufferDepth = 1;
+    }
+#endif // SCREEN_EPD_EXT3_FIXED
     u_bufferSizeV = v_screenSizeV; // vertical = wide size
     u_bufferSizeH = v_screenSizeH / 4; // horizontal = small size 112 / 4; 2 bits per pixel
 
@@ -492,27 +675,71 @@ void Screen_EPD_EXT3::begin()
     // Actually for 1 colour; BWR requires 2 pages.
     u_pageColourSize = (uint32_t)u_bufferSizeV * (uint32_t)u_bufferSizeH;
 
-#if defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
+    // Band buffer set by setBandBuffer(), even number of rows
+    s_bandHeight = v_screenSizeV;
+    if (s_flagBand)
+    {
+        u_bufferDepth = 1;
+        s_flagDoubleBuffer = false;
+        s_bandHeight = min((uint32_t)v_screenSizeV, s_bufferSize / u_bufferSizeH) & ~0x01;
+        if (s_bandHeight < 2)
+        {
+            mySerial.println();
+            mySerial.println(formatString("hV * Band buffer of %i bytes, %i required", s_bufferSize, 2 * u_bufferSizeH));
+            while (0x01);
+        }
+    }
 
-    if (s_newImage == 0)
+    // Frame-buffer set by setFrameBuffer() or static array, not resized
+    if ((s_bufferImage != 0) and (not s_flagBufferOwned) and (not s_flagBand) and (s_bufferSize < u_pageColourSize * u_bufferDepth))
     {
-        static uint8_t * _newFrameBuffer;
-        _newFrameBuffer = (uint8_t *) ps_malloc(u_pageColourSize * u_bufferDepth);
-        s_newImage = (uint8_t *) _newFrameBuffer;
+        if ((u_bufferDepth > 1) and (s_bufferSize >= u_pageColourSize))
+        {
+            mySerial.println("hV * Frame-buffer too small for double frame-buffer");
+            s_flagDoubleBuffer = false;
+            u_bufferDepth = 1;
+        }
+        else
+        {
+            mySerial.println();
+            mySerial.println(formatString("hV * Frame-buffer of %i bytes, %i required", s_bufferSize, u_pageColourSize * u_bufferDepth));
+            while (0x01);
+        }
     }
 
+    // Frame-buffer allocated, or re-allocated if too small
+    if ((not s_flagBand) and (s_bufferSize < u_pageColourSize * u_bufferDepth))
+    {
+        s_releaseBuffer();
+
+#if defined(SCREEN_EPD_EXT3_FIXED) // Screen fixed at compile time
+
+        static uint8_t _newFrameBuffer[pageSize_EPD_EXT3(SCREEN_EPD_EXT3_FIXED) * SCREEN_EPD_EXT3_FIXED_DEPTH];
+        s_bufferImage = (uint8_t *) _newFrameBuffer;
+        s_bufferSize = sizeof(_newFrameBuffer);
+        s_flagBufferOwned = false;
+
+#elif defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
+
+        s_bufferImage = (uint8_t *) ps_malloc(u_pageColourSize * u_bufferDepth);
+        s_bufferSize = u_pageColourSize * u_bufferDepth;
+        s_flagBufferOwned = true;
+
 #else // default case
 
-    if (s_newImage == 0)
-    {
-        static uint8_t * _newFrameBuffer;
-        _newFrameBuffer = new uint8_t[u_pageColourSize * u_bufferDepth];
-        s_newImage = (uint8_t *) _newFrameBuffer;
-    }
+        s_bufferImage = new uint8_t[u_pageColourSize * u_bufferDepth];
+        s_bufferSize = u_pageColourSize * u_bufferDepth;
+        s_flagBufferOwned = true;
 
 #endif // ESP32 BOARD_HAS_PSRAM
+    }
 
-    memset(s_newImage, 0x00, u_pageColourSize * u_bufferDepth);
+    // Frame-buffers back in allocation order, after swaps
+    s_newImage = s_bufferImage;
+
+    s_setBand(0);
+    memset(s_newImage, 0x00, s_bandSize * u_bufferDepth);
+    s_sendImage = s_newImage + s_bandSize * (u_bufferDepth - 1);
 
     setTemperatureC(25); // 25 Celsius = 77 Fahrenheit
     b_fsmPowerScreen = FSM_OFF;
@@ -521,10 +748,6 @@ void Screen_EPD_EXT3::begin()
         setPowerProfile(POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY);
     }
 
-    // Turn SPI on, initialise GPIOs and set GPIO levels
-    // Reset panel and get tables
-    resume();
-
     // Fonts
     hV_Screen_Buffer::begin(); // Standard
 
@@ -540,6 +763,11 @@ void Screen_EPD_EXT3::begin()
     v_penSolid = false;
     u_invert = false;
 
+    // First flush() always sent
+    s_setDirty(true);
+    s_flagHashValid = false;
+    s_flagListChanged = true;
+
     //
     // === Touch section
     //
@@ -599,281 +827,1643 @@ void Screen_EPD_EXT3::resume()
 
 uint8_t Screen_EPD_EXT3::flushMode(uint8_t updateMode)
 {
-    updateMode = checkTemperatureMode(updateMode);
+    // Complete asynchronous update in progress
+    s_flushStep(true);
+
+    updateMode = s_checkFlush(updateMode);
 
     switch (updateMode)
     {
         case UPDATE_FAST:
         case UPDATE_GLOBAL:
 
-            s_flush();
+            s_flagFlushAsync = false;
+            s_flush(updateMode);
             break;
 
         default:
 
-            mySerial.println();
-            mySerial.println("hV * UPDATE_NONE invoked");
             break;
     }
 
     return updateMode;
 }
 
-void Screen_EPD_EXT3::flush()
+uint8_t Screen_EPD_EXT3::flushAsync(uint8_t updateMode)
 {
-    flushMode(UPDATE_GLOBAL);
-}
+    // Update already in progress
+    if (isBusy())
+    {
+        return UPDATE_NONE;
+    }
 
-void Screen_EPD_EXT3::s_reset()
-{
-    // Reset
-    COG_SmallQ_reset();
-}
+    updateMode = s_checkFlush(updateMode);
 
-void Screen_EPD_EXT3::s_getDataOTP()
-{
-    hV_HAL_SPI_end(); // With unicity check
+    switch (updateMode)
+    {
+        case UPDATE_FAST:
+        case UPDATE_GLOBAL:
 
-    hV_HAL_SPI3_begin(); // Define 3-wire SPI pins
+            s_flagFlushAsync = true;
+            s_flushMode = updateMode;
+            s_flushState = FLUSH_INITIAL;
+            s_flushStep(false);
+            break;
 
-    // Get data OTP
-    COG_SmallQ_getDataOTP(); // 3-wire SPI read OTP memory
+        default:
+
+            break;
+    }
+
+    return updateMode;
 }
 
-void Screen_EPD_EXT3::s_flush(uint8_t updateMode)
+uint8_t Screen_EPD_EXT3::flushBands(void (*draw)())
 {
-    // Resume
-    if (b_fsmPowerScreen != FSM_ON)
+    // Update already in progress
+    if (s_flushState != FLUSH_IDLE)
     {
-        resume();
+        s_flushStep(true);
     }
 
-    COG_SmallQ_initial(); // Initialise
-    COG_SmallQ_sendImageData(); // Send image data
-    COG_SmallQ_update(); // Update
-    COG_SmallQ_powerOff(); // Power off
+    uint8_t updateMode = checkTemperatureMode(UPDATE_GLOBAL);
+    uint8_t listState;
 
-    // Suspend
-    if (u_suspendMode == POWER_MODE_AUTO)
+    switch (updateMode)
     {
-        suspend(u_suspendScope);
+        case UPDATE_FAST:
+        case UPDATE_GLOBAL:
+
+            // Scene drawn, not recorded
+            listState = s_listState;
+            s_listState = LIST_OFF;
+
+            s_bandDraw = draw;
+            s_flush(updateMode);
+            s_bandDraw = 0; // nullptr
+
+            s_listState = listState;
+            s_flagListChanged = true; // frame-buffer drawn, list replayed by next flush()
+            s_flagHashValid = false;
+            s_setDirty(false);
+            break;
+
+        default:
+
+            break;
     }
+
+    return updateMode;
 }
 
-void Screen_EPD_EXT3::clear(uint16_t colour)
+void Screen_EPD_EXT3::setDisplayList(uint8_t * buffer, uint32_t size)
 {
-    if (colour == myColours.grey)
-    {
-        // black = 0-1, white = 0-0
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
-        {
-            uint8_t pattern = (i % 2) ? 0b01000100 : 0b00010001; // black-white : white-black
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
-        }
-    }
-    else if ((colour == myColours.white) xor u_invert)
-    {
-        // physical black = 0-1
-        memset(s_newImage, 0b01010101, u_pageColourSize);
-    }
-    else if ((colour == myColours.black) xor u_invert)
-    {
-        // physical white = 0-0
-        memset(s_newImage, 0b00000000, u_pageColourSize);
-    }
-    else if (colour == myColours.red)
-    {
-        // physical red = 1-1
-        memset(s_newImage, 0b11111111, u_pageColourSize);
-    }
-    else if (colour == myColours.darkRed)
+    s_listBuffer = buffer;
+    s_listSize = (buffer != 0) ? size : 0;
+    s_listState = (buffer != 0) ? LIST_RECORD : LIST_OFF;
+    clearDisplayList();
+}
+
+void Screen_EPD_EXT3::clearDisplayList()
+{
+    s_listUsed = 0;
+    s_listLast = 0;
+    s_listCount = 0;
+    s_listOrientation = 0xff; // none
+    s_flagListFull = false;
+    s_flagListChanged = true;
+}
+
+uint32_t Screen_EPD_EXT3::getDisplayListLast()
+{
+    return s_listLast;
+}
+
+bool Screen_EPD_EXT3::setDisplayListText(uint32_t handle, String text)
+{
+    if (handle >= s_listUsed)
     {
-        // red = 1-1, black = 0-1
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
-        {
-            uint8_t pattern = (i % 2) ? 0b11011101 : 0b01110111; // red-black : black-red
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
-        }
+        return false;
     }
-    else if (colour == myColours.lightRed)
+
+    // Handle at the start of a command, walked from the first one
+    uint32_t index = 0;
+    while (index < handle)
     {
-        // red = 1-1, white = 0-0
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        uint16_t size = s_listCommandSize(s_listBuffer + index);
+        if (size == 0)
         {
-            uint8_t pattern = (i % 2) ? 0b11001100 : 0b00110011; // red-white : white-red
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
+            return false;
         }
+        index += size;
     }
-    else if (colour == myColours.yellow)
+
+    if ((index != handle) or (s_listBuffer[handle] != LIST_TEXT))
     {
-        // physical yellow = 1-0
-        memset(s_newImage, 0b10101010, u_pageColourSize);
+        return false;
     }
-    else if (colour == myColours.darkYellow)
+
+    // Same length as recorded, padded with spaces
+    uint8_t * command = s_listBuffer + handle;
+    uint8_t length = command[11];
+    for (uint8_t k = 0; k < length; k++)
     {
-        // yellow = 1-0, black = 0-1
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        char character = (k < text.length()) ? text.charAt(k) : ' ';
+        if (command[12 + k] != character)
         {
-            uint8_t pattern = (i % 2) ? 0b10011001 : 0b01100110; // yellow-black : black-yellow
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
+            command[12 + k] = character;
+            s_flagListChanged = true;
         }
     }
-    else if (colour == myColours.lightYellow)
+    return true;
+}
+
+void Screen_EPD_EXT3::getDisplayListSize(uint16_t & count, uint32_t & used)
+{
+    count = s_listCount;
+    used = s_listUsed;
+}
+
+uint8_t * Screen_EPD_EXT3::s_listReserve(uint16_t size)
+{
+    // Orientation command if changed
+    uint16_t extra = (v_orientation != s_listOrientation) ? 2 : 0;
+
+    if (s_listUsed + extra + size > s_listSize)
     {
-        // yellow = 1-0, white = 0-0
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        if (not s_flagListFull)
         {
-            uint8_t pattern = (i % 2) ? 0b10001000 : 0b00100010; // yellow-white : white-yellow
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
+            mySerial.println("hV * Display list full");
+            s_flagListFull = true;
         }
+        return 0; // nullptr
     }
-    else if (colour == myColours.orange)
+
+    if (extra > 0)
     {
-        // yellow = 1-0, red = 1-1
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
-        {
-            uint8_t pattern = (i % 2) ? 0b10111011 : 0b11101110; // yellow-red : red-yellow
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
-        }
+        s_listBuffer[s_listUsed] = LIST_ORIENTATION;
+        s_listBuffer[s_listUsed + 1] = v_orientation;
+        s_listOrientation = v_orientation;
+        s_listUsed += extra;
+        s_listCount++;
     }
+
+    s_listLast = s_listUsed;
+    s_listUsed += size;
+    s_listCount++;
+    s_flagListChanged = true;
+    return s_listBuffer + s_listLast;
 }
 
-void Screen_EPD_EXT3::regenerate(uint8_t mode)
+void Screen_EPD_EXT3::s_listShape(uint8_t type, uint8_t number, const uint16_t * values, uint16_t colour)
 {
-    clear();
-    flush();
+    uint8_t * command = s_listReserve(4 + 2 * number);
+    if (command != 0)
+    {
+        command[0] = type;
+        command[1] = v_penSolid;
+        for (uint8_t i = 0; i < number; i++)
+        {
+            s_listPut16(command + 2 + 2 * i, values[i]);
+        }
+        s_listPut16(command + 2 + 2 * number, colour);
+    }
+}
+
+uint16_t Screen_EPD_EXT3::s_listCommandSize(const uint8_t * command)
+{
+    switch (command[0])
+    {
+        case LIST_ORIENTATION:
+
+            return 2;
+
+        case LIST_CLEAR:
+        case LIST_FILL:
+
+            return 3;
+
+        case LIST_POINT:
+
+            return 7;
+
+        case LIST_AREA:
+
+            return 11;
+
+        case LIST_TEXT:
+
+            return 12 + command[11];
+
+        case LIST_LINE:
+        case LIST_ELLIPSE:
+
+            return 4 + 2 * 4;
+
+        case LIST_CIRCLE:
+
+            return 4 + 2 * 3;
+
+        case LIST_TRIANGLE:
+
+            return 4 + 2 * 6;
+
+        case LIST_ROUND:
+
+            return 4 + 2 * 5;
+
+        default:
+
+            return 0;
+    }
+}
+
+bool Screen_EPD_EXT3::s_listInBand(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    // Clip to screen
+    if ((x1 >= s_orientSizeX) or (y1 >= s_orientSizeY))
+    {
+        return false;
+    }
+
+    // Full frame-buffer
+    if (s_bandRows == v_screenSizeV)
+    {
+        return true;
+    }
+
+    x2 = min(x2, (uint16_t)(s_orientSizeX - 1));
+    y2 = min(y2, (uint16_t)(s_orientSizeY - 1));
+
+    // Physical rows
+    s_orientCoordinates(x1, y1);
+    s_orientCoordinates(x2, y2);
+    if (x1 > x2)
+    {
+        hV_HAL_swap(x1, x2);
+    }
+
+    return (x2 >= s_bandRow1) and (x1 < s_bandRow1 + s_bandRows);
+}
+
+void Screen_EPD_EXT3::s_listReplay()
+{
+    // Keep the settings changed by the commands
+    uint8_t oldOrientation = v_orientation;
+    uint8_t oldFont = f_fontSize;
+    bool oldFontSolid = f_fontSolid;
+    bool oldPenSolid = v_penSolid;
+
+    uint16_t x1, y1, x2, y2, colour, backColour;
+    uint16_t values[6];
+    uint8_t number;
+    uint32_t index = 0;
+
+    s_listState = LIST_REPLAY;
+    while (index < s_listUsed)
+    {
+        const uint8_t * command = s_listBuffer + index;
+
+        switch (command[0])
+        {
+            case LIST_ORIENTATION:
+
+                setOrientation(command[1]);
+                break;
+
+            case LIST_CLEAR:
+
+                clear(s_listGet16(command + 1));
+                break;
+
+            case LIST_FILL:
+
+                fillPattern(command[1], command[2]);
+                break;
+
+            case LIST_POINT:
+
+                x1 = s_listGet16(command + 1);
+                y1 = s_listGet16(command + 3);
+                if (s_listInBand(x1, y1, x1, y1))
+                {
+                    s_setPoint(x1, y1, s_listGet16(command + 5));
+                }
+                break;
+
+            case LIST_AREA:
+
+                x1 = s_listGet16(command + 1);
+                y1 = s_listGet16(command + 3);
+                x2 = s_listGet16(command + 5);
+                y2 = s_listGet16(command + 7);
+                if (s_listInBand(x1, y1, x2, y2))
+                {
+                    s_setArea(x1, y1, x2, y2, s_listGet16(command + 9));
+                }
+                break;
+
+            case LIST_TEXT:
+
+                x1 = s_listGet16(command + 1);
+                y1 = s_listGet16(command + 3);
+                colour = s_listGet16(command + 5);
+                backColour = s_listGet16(command + 7);
+                if (f_fontSize != command[9])
+                {
+                    selectFont(command[9]);
+                }
+                f_fontSolid = command[10];
+
+                x2 = x1 + f_font.maxWidth * command[11] - 1;
+                y2 = y1 + f_font.height - 1;
+                if (s_listInBand(x1, y1, x2, y2))
+                {
+                    for (uint8_t k = 0; k < command[11]; k++)
+                    {
+                        s_setCharacter(x1 + f_font.maxWidth * k, y1, command[12 + k] - ' ', colour, backColour);
+                    }
+                }
+                break;
+
+            case LIST_LINE:
+            case LIST_CIRCLE:
+            case LIST_TRIANGLE:
+            case LIST_ELLIPSE:
+            case LIST_ROUND:
+
+                number = (command[0] == LIST_TRIANGLE) ? 6 : (command[0] == LIST_CIRCLE) ? 3 : (command[0] == LIST_ROUND) ? 5 : 4;
+                for (uint8_t i = 0; i < number; i++)
+                {
+                    values[i] = s_listGet16(command + 2 + 2 * i);
+                }
+                colour = s_listGet16(command + 2 + 2 * number);
+                v_penSolid = command[1];
+
+                // Bounding box
+                if ((command[0] == LIST_CIRCLE) or (command[0] == LIST_ELLIPSE))
+                {
+                    x2 = values[2];
+                    y2 = (command[0] == LIST_CIRCLE) ? values[2] : values[3];
+                    x1 = (values[0] > x2) ? values[0] - x2 : 0;
+                    y1 = (values[1] > y2) ? values[1] - y2 : 0;
+                    x2 += values[0];
+                    y2 += values[1];
+                }
+                else
+                {
+                    x1 = min(values[0], values[2]);
+                    y1 = min(values[1], values[3]);
+                    x2 = max(values[0], values[2]);
+                    y2 = max(values[1], values[3]);
+                    if (command[0] == LIST_TRIANGLE)
+                    {
+                        x1 = min(x1, values[4]);
+                        y1 = min(y1, values[5]);
+                        x2 = max(x2, values[4]);
+                        y2 = max(y2, values[5]);
+                    }
+                }
+
+                if (s_listInBand(x1, y1, x2, y2))
+                {
+                    switch (command[0])
+                    {
+                        case LIST_LINE:
+
+                            hV_Screen_Buffer::line(values[0], values[1], values[2], values[3], colour);
+                            break;
+
+                        case LIST_CIRCLE:
+
+                            hV_Screen_Buffer::circle(values[0], values[1], values[2], colour);
+                            break;
+
+                        case LIST_TRIANGLE:
+
+                            hV_Screen_Buffer::triangle(values[0], values[1], values[2], values[3], values[4], values[5], colour);
+                            break;
+
+                        case LIST_ELLIPSE:
+
+                            hV_Screen_Buffer::ellipse(values[0], values[1], values[2], values[3], colour);
+                            break;
+
+                        default: // LIST_ROUND
+
+                            hV_Screen_Buffer::roundRectangle(values[0], values[1], values[2], values[3], values[4], colour);
+                            break;
+                    }
+                }
+                break;
+
+            default:
+
+                mySerial.println(formatString("hV * Display list corrupted at %i", index));
+                while (0x01);
+                break;
+        }
+        index += s_listCommandSize(command);
+    }
+    s_listState = LIST_RECORD;
+    s_listInvert = u_invert;
+
+    if (v_orientation != oldOrientation)
+    {
+        setOrientation(oldOrientation);
+    }
+    if (f_fontSize != oldFont)
+    {
+        selectFont(oldFont);
+    }
+    f_fontSolid = oldFontSolid;
+    v_penSolid = oldPenSolid;
+}
+
+bool Screen_EPD_EXT3::isBusy()
+{
+    s_flushStep(false);
+
+    return (s_flushState != FLUSH_IDLE);
+}
+
+void Screen_EPD_EXT3::setDoubleBuffer(bool flag)
+{
+    s_flagDoubleBuffer = flag;
+}
+
+void Screen_EPD_EXT3::s_swapBuffers()
+{
+    if (u_bufferDepth > 1)
+    {
+        hV_HAL_swap(s_newImage, s_sendImage);
+        memcpy(s_newImage, s_sendImage, s_getPageSize());
+    }
+}
+
+uint16_t Screen_EPD_EXT3::s_getChecksum(const uint8_t * data, uint16_t size)
+{
+    // Fletcher-16
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+
+    for (uint16_t index = 0; index < size; index += 1)
+    {
+        sum1 = (sum1 + data[index]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+
+    return (sum2 << 8) | sum1;
+}
+
+uint16_t Screen_EPD_EXT3::exportOTP(uint8_t * buffer, uint16_t size)
+{
+    uint16_t chipId = 0;
+    uint16_t readBytes = 0;
+
+    if ((u_flagOTP == false) or (COG_SmallQ_getTypeOTP(chipId, readBytes) == false))
+    {
+        return 0;
+    }
+
+    uint16_t length = 12 + readBytes + 2;
+    if ((buffer == 0) or (size < length))
+    {
+        return 0;
+    }
+
+    // Header, little endian
+    buffer[0] = 'h'; // Magic
+    buffer[1] = 'V';
+    buffer[2] = 0x01; // Format
+    buffer[3] = 0x00;
+    for (uint8_t index = 0; index < 4; index += 1)
+    {
+        buffer[4 + index] = (u_eScreen_EPD >> (8 * index)) & 0xff;
+    }
+    buffer[8] = chipId & 0xff;
+    buffer[9] = chipId >> 8;
+    buffer[10] = readBytes & 0xff;
+    buffer[11] = readBytes >> 8;
+
+    // OTP table
+    memcpy(buffer + 12, COG_data, readBytes);
+
+    // Checksum
+    uint16_t checksum = s_getChecksum(buffer, 12 + readBytes);
+    buffer[12 + readBytes] = checksum & 0xff;
+    buffer[12 + readBytes + 1] = checksum >> 8;
+
+    return length;
+}
+
+bool Screen_EPD_EXT3::importOTP(const uint8_t * buffer, uint16_t size)
+{
+    uint16_t chipId = 0;
+    uint16_t readBytes = 0;
+
+    if ((buffer == 0) or (size < 14) or (COG_SmallQ_getTypeOTP(chipId, readBytes) == false))
+    {
+        return false;
+    }
+
+    // Header
+    uint32_t screen = 0;
+    for (uint8_t index = 0; index < 4; index += 1)
+    {
+        screen |= (uint32_t)buffer[4 + index] << (8 * index);
+    }
+
+    if ((buffer[0] != 'h') or (buffer[1] != 'V') or (buffer[2] != 0x01) or (screen != u_eScreen_EPD))
+    {
+        return false;
+    }
+    if ((buffer[8] != (chipId & 0xff)) or (buffer[9] != (chipId >> 8)))
+    {
+        return false;
+    }
+    if ((buffer[10] != (readBytes & 0xff)) or (buffer[11] != (readBytes >> 8)) or (size < 12 + readBytes + 2))
+    {
+        return false;
+    }
+
+    // Checksum and first byte of OTP table
+    uint16_t checksum = s_getChecksum(buffer, 12 + readBytes);
+    if ((buffer[12 + readBytes] != (checksum & 0xff)) or (buffer[12 + readBytes + 1] != (checksum >> 8)) or (buffer[12] != 0xa5))
+    {
+        return false;
+    }
+
+    memcpy(COG_data, buffer + 12, readBytes);
+    u_flagOTP = true;
+
+    return true;
+}
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+const flushStats_s & Screen_EPD_EXT3::getFlushStats()
+{
+    return s_stats;
+}
+
+void Screen_EPD_EXT3::setFlushTrace(void (*callback)(uint8_t step, uint32_t duration))
+{
+    s_statsTrace = callback;
+}
+
+void Screen_EPD_EXT3::s_statsRecord(uint8_t step)
+{
+    uint32_t chrono = micros();
+    uint32_t duration = chrono - s_statsChrono;
+
+    // Previous step, including the wait for the panel
+    switch (s_statsStep)
+    {
+        case FLUSH_INITIAL:
+
+            s_stats.initial += duration;
+            break;
+
+        case FLUSH_SEND:
+
+            s_stats.send += duration;
+            break;
+
+        case FLUSH_REFRESH:
+
+            s_stats.refresh += duration;
+            break;
+
+        case FLUSH_OFF:
+        case FLUSH_PAUSE:
+        case FLUSH_RESTORE:
+
+            s_stats.powerOff += duration;
+            break;
+
+        default:
+
+            break;
+    }
+
+    if ((s_statsTrace != 0) and (s_statsStep != FLUSH_IDLE))
+    {
+        s_statsTrace(s_statsStep, duration);
+    }
+
+    // Next step
+    switch (step)
+    {
+        case FLUSH_INITIAL:
+
+            s_stats.count += 1;
+            s_stats.resume = 0;
+            s_stats.initial = 0;
+            s_stats.send = 0;
+            s_stats.refresh = 0;
+            s_stats.powerOff = 0;
+            s_stats.total = 0;
+            b_countBytes = 0;
+            b_countPolls = 0;
+            s_statsStart = chrono;
+            break;
+
+        case FLUSH_END:
+
+            s_stats.total = chrono - s_statsStart;
+            s_stats.bytes = b_countBytes;
+            s_stats.polls = b_countPolls;
+            break;
+
+        default:
+
+            break;
+    }
+
+    s_statsStep = (step == FLUSH_END) ? FLUSH_IDLE : step;
+    s_statsChrono = chrono;
+}
+#endif // DEBUG_MODE
+
+void Screen_EPD_EXT3::setFlushCallback(void (*callback)(uint8_t updateMode))
+{
+    s_flushCallback = callback;
+}
+
+uint8_t Screen_EPD_EXT3::s_checkFlush(uint8_t updateMode)
+{
+    bool flagBand = (s_bandRows < v_screenSizeV);
+
+    // Band buffer holds only one band, display list replayed band by band
+    if (flagBand and (s_listState == LIST_OFF))
+    {
+        mySerial.println("hV * Band buffer, use flushBands()");
+        return UPDATE_NONE;
+    }
+
+    // Display list replayed into the full frame-buffer, only if changed since last replay
+    if ((not flagBand) and (s_listState != LIST_OFF) and (s_flagListChanged or (u_invert != s_listInvert)))
+    {
+        s_listReplay();
+        s_flagListChanged = false;
+    }
+
+    // Skip if frame-buffer unchanged since last flush()
+    s_foldDirty();
+    if ((not flagBand) and (s_dirtyRow1 > s_dirtyRow2))
+    {
+        return UPDATE_NONE;
+    }
+
+    // Skip if frame-buffer identical to last frame sent
+    uint32_t hash = 0;
+    if (s_flagHash and (not flagBand))
+    {
+        hash = s_getFrameHash();
+        if (s_flagHashValid and (hash == s_hash))
+        {
+            s_hashSkipped++;
+            s_setDirty(false);
+            return UPDATE_NONE;
+        }
+    }
+
+    updateMode = checkTemperatureMode(updateMode);
+
+    switch (updateMode)
+    {
+        case UPDATE_FAST:
+        case UPDATE_GLOBAL:
+
+            if (s_flagHash and (not flagBand))
+            {
+                s_hash = hash;
+                s_flagHashValid = true;
+                s_hashSent++;
+            }
+            break;
+
+        default:
+
+            mySerial.println();
+            mySerial.println("hV * UPDATE_NONE invoked");
+            break;
+    }
+
+    return updateMode;
+}
+
+void Screen_EPD_EXT3::flush()
+{
+    flushMode(UPDATE_GLOBAL);
+}
+
+void Screen_EPD_EXT3::setFrameHash(bool flag)
+{
+    s_flagHash = flag;
+    s_flagHashValid = false;
+    s_hashSkipped = 0;
+    s_hashSent = 0;
+}
+
+void Screen_EPD_EXT3::getFrameHashCounters(uint32_t & skipped, uint32_t & sent)
+{
+    skipped = s_hashSkipped;
+    sent = s_hashSent;
+}
+
+void Screen_EPD_EXT3::setGlyphCache(uint8_t * buffer, uint32_t size)
+{
+    memset(&s_glyphCache, 0x00, sizeof(s_glyphCache));
+    s_glyphCache.buffer = buffer;
+    s_glyphCache.size = (buffer != 0) ? size : 0;
+}
+
+void Screen_EPD_EXT3::getGlyphCacheCounters(uint32_t & hits, uint32_t & misses)
+{
+    hits = s_glyphCache.hits;
+    misses = s_glyphCache.misses;
+}
+
+uint32_t Screen_EPD_EXT3::s_getFrameHash()
+{
+    // FNV-1a, 32-bit words, frame-buffer size multiple of 4
+    uint32_t hash = 2166136261;
+    uint32_t word;
+
+    for (uint32_t i = 0; i < s_getPageSize(); i += 4)
+    {
+        memcpy(&word, s_newImage + i, 4); // alignment-safe
+        hash = (hash ^ word) * 16777619;
+    }
+
+    return hash;
+}
+
+void Screen_EPD_EXT3::s_reset()
+{
+    // Reset
+    COG_SmallQ_reset();
+}
+
+void Screen_EPD_EXT3::s_getDataOTP()
+{
+    hV_HAL_SPI_end(); // With unicity check
+
+    hV_HAL_SPI3_begin(); // Define 3-wire SPI pins
+
+    // Get data OTP
+    COG_SmallQ_getDataOTP(); // 3-wire SPI read OTP memory
+}
+
+void Screen_EPD_EXT3::s_flush(uint8_t updateMode)
+{
+    s_flushMode = updateMode;
+    s_flushState = FLUSH_INITIAL;
+    s_flushStep(true);
+}
+
+void Screen_EPD_EXT3::s_flushStep(bool flagWait)
+{
+    while (s_flushState != FLUSH_IDLE)
+    {
+        // Wait for panel ready, except before resume
+        if (s_flushState != FLUSH_INITIAL)
+        {
+            if (flagWait)
+            {
+                b_waitBusy();
+            }
+            else if (digitalRead(b_pin.panelBusy) != HIGH)
+            {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+                b_countPolls += 1;
+#endif // DEBUG_MODE
+                return;
+            }
+        }
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+        s_statsRecord(s_flushState);
+#endif // DEBUG_MODE
+
+        switch (s_flushState)
+        {
+            case FLUSH_INITIAL:
+
+                // Frame-buffer to be sent, drawing continues on the other one
+                s_swapBuffers();
+                s_setDirty(false);
+
+                // Resume
+                if (b_fsmPowerScreen != FSM_ON)
+                {
+                    resume();
+                }
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+                s_stats.resume = micros() - s_statsChrono;
+                s_statsChrono = micros();
+#endif // DEBUG_MODE
+
+                COG_SmallQ_initial(); // Initialise
+                s_flushState = FLUSH_SEND;
+                break;
+
+            case FLUSH_SEND:
+
+                COG_SmallQ_sendImageData(); // Send image data
+                COG_SmallQ_powerOn(); // Power on
+                s_flushState = FLUSH_REFRESH;
+                break;
+
+            case FLUSH_REFRESH:
+
+                COG_SmallQ_update(); // Update
+                s_flushState = FLUSH_OFF;
+                break;
+
+            case FLUSH_OFF:
+
+                COG_SmallQ_powerOff(); // Power off
+                s_flushState = FLUSH_PAUSE;
+                break;
+
+            case FLUSH_PAUSE:
+
+                s_flushChrono = millis();
+                s_flushState = FLUSH_RESTORE;
+                break;
+
+            case FLUSH_RESTORE:
+            {
+                uint32_t elapsed = millis() - s_flushChrono;
+                uint32_t restoreDelay = COG_SmallQ_getRestoreDelay();
+                if (elapsed < restoreDelay)
+                {
+                    if (not flagWait)
+                    {
+                        return;
+                    }
+                    delay(restoreDelay - elapsed);
+                }
+
+                COG_SmallQ_restore(); // Restore settings
+                s_flushState = FLUSH_END;
+                break;
+            }
+
+            default: // FLUSH_END
+
+                // Suspend
+                if (u_suspendMode == POWER_MODE_AUTO)
+                {
+                    suspend(u_suspendScope);
+                }
+
+                s_flushState = FLUSH_IDLE;
+                if (s_flagFlushAsync and (s_flushCallback != 0))
+                {
+                    s_flagFlushAsync = false;
+                    s_flushCallback(s_flushMode);
+                }
+                break;
+        }
+    }
+}
+
+void Screen_EPD_EXT3::clear(uint16_t colour)
+{
+    if (s_listState == LIST_RECORD)
+    {
+        uint8_t * command = s_listReserve(3);
+        if (command != 0)
+        {
+            command[0] = LIST_CLEAR;
+            s_listPut16(command + 1, colour);
+        }
+        return;
+    }
+
+    const colour2bpp_s & descriptor = s_resolveColour(colour);
+    if (not descriptor.valid)
+    {
+        return;
+    }
+
+    fillPattern(descriptor.patternEven, descriptor.patternOdd);
+}
+
+void Screen_EPD_EXT3::gText(uint16_t x0, uint16_t y0,
+                            String text,
+                            uint16_t textColour,
+                            uint16_t backColour)
+{
+    if (s_listState != LIST_RECORD)
+    {
+        hV_Screen_Buffer::gText(x0, y0, text, textColour, backColour);
+        return;
+    }
+
+    uint8_t length = min(text.length(), (unsigned int)255);
+    uint8_t * command = s_listReserve(12 + length);
+    if (command != 0)
+    {
+        command[0] = LIST_TEXT;
+        s_listPut16(command + 1, x0);
+        s_listPut16(command + 3, y0);
+        s_listPut16(command + 5, textColour);
+        s_listPut16(command + 7, backColour);
+        command[9] = f_fontSize;
+        command[10] = f_fontSolid;
+        command[11] = length;
+        for (uint8_t k = 0; k < length; k++)
+        {
+            command[12 + k] = text.charAt(k);
+        }
+    }
+}
+
+void Screen_EPD_EXT3::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (s_listState != LIST_RECORD)
+    {
+        hV_Screen_Buffer::line(x1, y1, x2, y2, colour);
+        return;
+    }
+
+    uint16_t values[] = {x1, y1, x2, y2};
+    s_listShape(LIST_LINE, 4, values, colour);
+}
+
+void Screen_EPD_EXT3::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
+{
+    if (s_listState != LIST_RECORD)
+    {
+        hV_Screen_Buffer::circle(x0, y0, radius, colour);
+        return;
+    }
+
+    uint16_t values[] = {x0, y0, radius};
+    s_listShape(LIST_CIRCLE, 3, values, colour);
+}
+
+void Screen_EPD_EXT3::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+{
+    if (s_listState != LIST_RECORD)
+    {
+        hV_Screen_Buffer::triangle(x1, y1, x2, y2, x3, y3, colour);
+        return;
+    }
+
+    uint16_t values[] = {x1, y1, x2, y2, x3, y3};
+    s_listShape(LIST_TRIANGLE, 6, values, colour);
+}
+
+void Screen_EPD_EXT3::ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour)
+{
+    if (s_listState != LIST_RECORD)
+    {
+        hV_Screen_Buffer::ellipse(x0, y0, radiusX, radiusY, colour);
+        return;
+    }
+
+    uint16_t values[] = {x0, y0, radiusX, radiusY};
+    s_listShape(LIST_ELLIPSE, 4, values, colour);
 }
 
-void Screen_EPD_EXT3::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+void Screen_EPD_EXT3::roundRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour)
 {
-    // Orient and check coordinates are within screen
-    if (s_orientCoordinates(x1, y1) == RESULT_ERROR)
+    if (s_listState != LIST_RECORD)
     {
+        hV_Screen_Buffer::roundRectangle(x1, y1, x2, y2, radius, colour);
         return;
     }
 
-    // Convert combined colours into basic colours
-    bool flagOdd = ((x1 + y1) % 2 == 0);
+    uint16_t values[] = {x1, y1, x2, y2, radius};
+    s_listShape(LIST_ROUND, 5, values, colour);
+}
 
-    if (colour == myColours.grey)
+void Screen_EPD_EXT3::fillPattern(uint8_t patternEven, uint8_t patternOdd)
+{
+    if (s_listState == LIST_RECORD)
     {
-        if (flagOdd)
+        uint8_t * command = s_listReserve(3);
+        if (command != 0)
         {
-            colour = myColours.black; // black
+            command[0] = LIST_FILL;
+            command[1] = patternEven;
+            command[2] = patternOdd;
         }
-        else
+        return;
+    }
+
+    uint32_t pageSize = s_bandSize; // full frame-buffer or band
+    s_setDirty(true);
+
+    if (patternEven == patternOdd)
+    {
+        memset(s_newImage, patternEven, pageSize);
+        return;
+    }
+
+    // First two rows, then doubled until the end of the frame-buffer
+    uint32_t size = min((uint32_t)s_getBufferSizeH(), pageSize);
+    memset(s_newImage, patternEven, size);
+    if (size < pageSize)
+    {
+        memset(s_newImage + size, patternOdd, min(size, pageSize - size));
+        size *= 2;
+    }
+
+    while (size < pageSize)
+    {
+        uint32_t chunk = min(size, pageSize - size);
+        memcpy(s_newImage + size, s_newImage, chunk);
+        size += chunk;
+    }
+}
+
+void Screen_EPD_EXT3::regenerate(uint8_t mode)
+{
+    s_flagHashValid = false; // Refresh even if identical
+
+    // Neither recorded nor replayed
+    uint8_t listState = s_listState;
+    s_listState = LIST_OFF;
+    clear();
+    flush();
+    s_listState = listState;
+    s_flagListChanged = true; // frame-buffer cleared, list replayed by next flush()
+}
+
+void Screen_EPD_EXT3::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+    if (s_listState == LIST_RECORD)
+    {
+        uint8_t * command = s_listReserve(7);
+        if (command != 0)
         {
-            colour = myColours.white; // white
+            command[0] = LIST_POINT;
+            s_listPut16(command + 1, x1);
+            s_listPut16(command + 3, y1);
+            s_listPut16(command + 5, colour);
         }
+        return;
     }
-    else if (colour == myColours.darkRed)
+
+    // Check coordinates are within screen
+    if ((x1 >= s_orientSizeX) or (y1 >= s_orientSizeY))
+    {
+        return;
+    }
+
+    const colour2bpp_s & descriptor = s_resolveColour(colour);
+    if (not descriptor.valid)
+    {
+        return;
+    }
+    uint8_t code = ((x1 + y1 + s_orientParity) % 2 == 0) ? descriptor.codeEven : descriptor.codeOdd;
+
+    // Dirty area
+    s_dirtyX1 = min(s_dirtyX1, x1);
+    s_dirtyY1 = min(s_dirtyY1, y1);
+    s_dirtyX2 = max(s_dirtyX2, x1);
+    s_dirtyY2 = max(s_dirtyY2, y1);
+
+    // Orient and convert into index and bit, 4 pixels per byte
+    uint32_t p1 = s_orientIndex0 + (int32_t)x1 * s_orientStepX + (int32_t)y1 * s_orientStepY;
+    uint32_t i1 = (p1 >> 2) - s_bandStart; // relative to band
+    if (i1 >= s_bandSize)
+    {
+        return;
+    }
+    uint8_t * z1 = s_newImage + i1;
+    uint8_t b1 = 6 - 2 * (p1 & 0b11);
+
+    *z1 = (*z1 & ~(0b11 << b1)) | (code << b1);
+}
+
+void Screen_EPD_EXT3::s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (s_listState == LIST_RECORD)
     {
-        if (flagOdd)
+        uint8_t * command = s_listReserve(11);
+        if (command != 0)
         {
-            colour = myColours.red; // red
+            command[0] = LIST_AREA;
+            s_listPut16(command + 1, x1);
+            s_listPut16(command + 3, y1);
+            s_listPut16(command + 5, x2);
+            s_listPut16(command + 7, y2);
+            s_listPut16(command + 9, colour);
         }
-        else
+        return;
+    }
+
+    // Check and clip coordinates
+    if ((x1 >= screenSizeX()) or (y1 >= screenSizeY()))
+    {
+        return;
+    }
+    x2 = min(x2, (uint16_t)(screenSizeX() - 1));
+    y2 = min(y2, (uint16_t)(screenSizeY() - 1));
+
+    const colour2bpp_s & descriptor = s_resolveColour(colour);
+    if (not descriptor.valid)
+    {
+        return;
+    }
+
+    // Dirty area
+    s_dirtyX1 = min(s_dirtyX1, x1);
+    s_dirtyY1 = min(s_dirtyY1, y1);
+    s_dirtyX2 = max(s_dirtyX2, x2);
+    s_dirtyY2 = max(s_dirtyY2, y2);
+
+    // Orient both corners
+    s_orientCoordinates(x1, y1);
+    s_orientCoordinates(x2, y2);
+    if (x1 > x2)
+    {
+        hV_HAL_swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        hV_HAL_swap(y1, y2);
+    }
+
+    // Clip to band
+    x1 = max(x1, s_bandRow1);
+    x2 = min(x2, (uint16_t)(s_bandRow1 + s_bandRows - 1));
+
+    if (y1 == y2)
+    {
+        // One pixel per row, same byte and mask, as a logical row across physical rows
+        uint16_t bufferSizeH = s_getBufferSizeH();
+        uint8_t * z1 = s_newImage + (uint32_t)(x1 - s_bandRow1) * bufferSizeH + (y1 >> 2);
+        uint8_t mask = 0b11 << (6 - 2 * (y1 % 4));
+
+        for (uint16_t x = x1; x <= x2; x++, z1 += bufferSizeH)
         {
-            colour = u_invert ? myColours.white : myColours.black; // white
+            *z1 = (*z1 & ~mask) | (((x % 2) ? descriptor.patternOdd : descriptor.patternEven) & mask);
         }
     }
-    else if (colour == myColours.lightRed)
+    else
+    {
+        for (uint16_t x = x1; x <= x2; x++)
+        {
+            s_setSpan(x, y1, y2, (x % 2) ? descriptor.patternOdd : descriptor.patternEven);
+        }
+    }
+}
+
+void Screen_EPD_EXT3::s_setColumn(uint16_t x1, uint16_t y1, uint32_t bits, uint8_t height, uint16_t textColour, uint16_t backColour, bool flagSolid)
+{
+    // Check and clip coordinates
+    if ((x1 >= s_orientSizeX) or (y1 >= s_orientSizeY))
+    {
+        return;
+    }
+    height = min(height, (uint8_t)min((uint16_t)(s_orientSizeY - y1), (uint16_t)32));
+
+    // Resolve colours once, both kept by the two-entry cache
+    const colour2bpp_s & text = s_resolveColour(textColour);
+    const colour2bpp_s & back = s_resolveColour(backColour);
+    flagSolid = flagSolid and back.valid;
+    if (not text.valid)
+    {
+        bits = 0;
+    }
+    if ((bits == 0) and (not flagSolid))
     {
-        if (flagOdd)
+        return;
+    }
+
+    // Dirty area
+    s_dirtyX1 = min(s_dirtyX1, x1);
+    s_dirtyY1 = min(s_dirtyY1, y1);
+    s_dirtyX2 = max(s_dirtyX2, x1);
+    s_dirtyY2 = max(s_dirtyY2, (uint16_t)(y1 + height - 1));
+
+    // Orient once, then step along the column
+    uint32_t p1 = s_orientIndex0 + (int32_t)x1 * s_orientStepX + (int32_t)y1 * s_orientStepY;
+    uint8_t parity = (x1 + y1 + s_orientParity) % 2;
+
+    for (uint8_t j = 0; j < height; j++, p1 += s_orientStepY, parity ^= 0x01, bits >>= 1)
+    {
+        uint8_t code;
+        if (bits & 0x01)
+        {
+            code = parity ? text.codeOdd : text.codeEven;
+        }
+        else if (flagSolid)
         {
-            colour = myColours.red; // red
+            code = parity ? back.codeOdd : back.codeEven;
         }
         else
         {
-            colour = u_invert ? myColours.black : myColours.white; // black
+            continue;
         }
+
+        uint32_t i1 = (p1 >> 2) - s_bandStart; // relative to band
+        if (i1 >= s_bandSize)
+        {
+            continue;
+        }
+        uint8_t * z1 = s_newImage + i1;
+        uint8_t b1 = 6 - 2 * (p1 & 0b11);
+
+        *z1 = (*z1 & ~(0b11 << b1)) | (code << b1);
     }
-    else if (colour == myColours.darkYellow)
+}
+
+void Screen_EPD_EXT3::s_setCharacter(uint16_t x0, uint16_t y0, uint8_t character, uint16_t textColour, uint16_t backColour)
+{
+    glyphCache_s & cache = s_glyphCache;
+    uint8_t width = f_font.maxWidth;
+    uint8_t height = f_font.height;
+
+    // Glyph on screen and cache usable, otherwise column by column
+    if ((x0 + width > s_orientSizeX) or (y0 + height > s_orientSizeY) or (not s_checkGlyphCache(textColour, backColour)))
+    {
+        hV_Screen_Buffer::s_setCharacter(x0, y0, character, textColour, backColour);
+        return;
+    }
+
+    // Physical position of the slot
+    uint32_t p0 = s_orientIndex0 + (int32_t)x0 * s_orientStepX + (int32_t)y0 * s_orientStepY;
+    uint16_t row1 = p0 / v_screenSizeH - cache.row0;
+    uint16_t column1 = p0 % v_screenSizeH - cache.column0;
+
+    // Glyph within band, otherwise column by column
+    if ((row1 < s_bandRow1) or (row1 + cache.rows > s_bandRow1 + s_bandRows))
+    {
+        hV_Screen_Buffer::s_setCharacter(x0, y0, character, textColour, backColour);
+        return;
+    }
+
+    // Look-up, direct-mapped on character and parity
+    uint8_t parity = (x0 + y0) % 2;
+    uint8_t * slot = cache.buffer + (uint32_t)((character * 2 + parity) % cache.slots) * cache.slotSize;
+    if ((slot[0] == character + 1) and (slot[1] == parity))
+    {
+        cache.hits++;
+    }
+    else
+    {
+        s_expandGlyph(slot, character, parity);
+    }
+
+    // Columns drawn, none if first > last
+    if (slot[2] > slot[3])
     {
-        if (flagOdd)
+        return;
+    }
+
+    // Dirty area
+    s_dirtyX1 = min(s_dirtyX1, (uint16_t)(x0 + slot[2]));
+    s_dirtyY1 = min(s_dirtyY1, y0);
+    s_dirtyX2 = max(s_dirtyX2, (uint16_t)(x0 + slot[3]));
+    s_dirtyY2 = max(s_dirtyY2, (uint16_t)(y0 + height - 1));
+
+    // Copy or merge row by row, shifted if not aligned on 4 pixels
+    const uint8_t * codes = slot + 4;
+    const uint8_t * masks = codes + cache.rows * cache.bytes;
+    uint16_t bufferSizeH = s_getBufferSizeH();
+    uint8_t * line = s_newImage + (uint32_t)(row1 - s_bandRow1) * bufferSizeH + (column1 >> 2);
+    uint8_t shift = 2 * (column1 % 4);
+    uint8_t last = ((column1 + cache.columns - 1) >> 2) - (column1 >> 2); // last byte, relative
+
+    for (uint8_t row = 0; row < cache.rows; row++, codes += cache.bytes, masks += cache.bytes, line += bufferSizeH)
+    {
+        if (shift == 0)
         {
-            colour = myColours.yellow; // yellow
+            if (cache.full)
+            {
+                memcpy(line, codes, cache.bytes);
+            }
+            else
+            {
+                for (uint8_t k = 0; k < cache.bytes; k++)
+                {
+                    line[k] = (line[k] & ~masks[k]) | codes[k];
+                }
+            }
         }
         else
         {
-            colour = myColours.black; // black
+            for (uint8_t k = 0; k <= last; k++)
+            {
+                uint8_t code = (k < cache.bytes) ? (codes[k] >> shift) : 0;
+                uint8_t mask = (k < cache.bytes) ? (masks[k] >> shift) : 0;
+                if (k > 0)
+                {
+                    code |= codes[k - 1] << (8 - shift);
+                    mask |= masks[k - 1] << (8 - shift);
+                }
+                line[k] = (line[k] & ~mask) | code;
+            }
         }
     }
-    else if (colour == myColours.lightYellow)
+}
+
+bool Screen_EPD_EXT3::s_checkGlyphCache(uint16_t textColour, uint16_t backColour)
+{
+    glyphCache_s & cache = s_glyphCache;
+
+    if (cache.buffer == 0)
+    {
+        return false;
+    }
+
+    // Same context as last glyph
+    if (cache.valid and (cache.fontSize == f_fontSize) and (cache.textColour == textColour) and (cache.backColour == backColour)
+            and (cache.solid == f_fontSolid) and (cache.invert == u_invert) and (cache.orientation == v_orientation))
+    {
+        return (cache.slots > 0);
+    }
+
+    cache.fontSize = f_fontSize;
+    cache.textColour = textColour;
+    cache.backColour = backColour;
+    cache.solid = f_fontSolid;
+    cache.invert = u_invert;
+    cache.orientation = v_orientation;
+
+    // Physical steps, one along the row, the other across rows
+    int32_t sizeH = v_screenSizeH;
+    bool flagRowX = (s_orientStepX != 1) and (s_orientStepX != -1);
+    cache.rowX = flagRowX ? s_orientStepX / sizeH : 0;
+    cache.columnX = flagRowX ? 0 : s_orientStepX;
+    cache.rowY = flagRowX ? 0 : s_orientStepY / sizeH;
+    cache.columnY = flagRowX ? s_orientStepY : 0;
+
+    uint8_t width = f_font.maxWidth;
+    uint8_t height = f_font.height;
+    cache.rows = flagRowX ? width : height;
+    cache.columns = flagRowX ? height : width;
+    cache.bytes = (cache.columns + 3) / 4;
+    cache.row0 = ((cache.rowX < 0) ? width - 1 : 0) + ((cache.rowY < 0) ? height - 1 : 0);
+    cache.column0 = ((cache.columnX < 0) ? width - 1 : 0) + ((cache.columnY < 0) ? height - 1 : 0);
+
+    // Masks all set if solid on full bytes
+    const colour2bpp_s & back = s_resolveColour(backColour);
+    cache.full = f_fontSolid and back.valid and (cache.columns % 4 == 0);
+
+    // Empty slots
+    cache.slotSize = 4 + 2 * cache.rows * cache.bytes;
+    cache.slots = min(cache.size / cache.slotSize, (uint32_t)0xffff);
+    for (uint16_t index = 0; index < cache.slots; index++)
+    {
+        cache.buffer[(uint32_t)index * cache.slotSize] = 0;
+    }
+
+    cache.valid = true;
+    return (cache.slots > 0);
+}
+
+void Screen_EPD_EXT3::s_expandGlyph(uint8_t * slot, uint8_t character, uint8_t parity)
+{
+    glyphCache_s & cache = s_glyphCache;
+    uint32_t bits;
+
+    // One, two or three bytes per column
+    uint8_t width = f_font.maxWidth;
+    uint8_t height = f_font.height;
+    uint8_t bytes = (height + 7) / 8;
+
+    uint16_t size = cache.rows * cache.bytes;
+    uint8_t * codes = slot + 4;
+    uint8_t * masks = codes + size;
+    memset(codes, 0x00, 2 * size);
+
+    // Resolve colours once, both kept by the two-entry cache
+    const colour2bpp_s & text = s_resolveColour(cache.textColour);
+    const colour2bpp_s & back = s_resolveColour(cache.backColour);
+    bool flagSolid = cache.solid and back.valid;
+
+    // Columns drawn, none if first > last
+    uint8_t first = width;
+    uint8_t last = 0;
+
+    for (uint8_t i = 0; i < width; i++)
     {
-        if (flagOdd)
+        bits = 0;
+        if (text.valid)
         {
-            colour = myColours.yellow; // yellow
+            for (uint8_t b = 0; b < bytes; b++)
+            {
+                bits |= (uint32_t)f_getCharacter(character, bytes * i + b) << (8 * b);
+            }
         }
-        else
+        if ((bits == 0) and (not flagSolid))
         {
-            colour = myColours.white; // white
+            continue;
+        }
+        first = min(first, i);
+        last = i;
+
+        for (uint8_t j = 0; j < height; j++, bits >>= 1)
+        {
+            uint8_t odd = (parity + s_orientParity + i + j) % 2;
+            uint8_t code;
+            if (bits & 0x01)
+            {
+                code = odd ? text.codeOdd : text.codeEven;
+            }
+            else if (flagSolid)
+            {
+                code = odd ? back.codeOdd : back.codeEven;
+            }
+            else
+            {
+                continue;
+            }
+
+            uint8_t row = cache.row0 + i * cache.rowX + j * cache.rowY;
+            uint8_t column = cache.column0 + i * cache.columnX + j * cache.columnY;
+            uint16_t index = row * cache.bytes + (column >> 2);
+            uint8_t b1 = 6 - 2 * (column & 0b11);
+
+            codes[index] |= code << b1;
+            masks[index] |= 0b11 << b1;
         }
     }
-    else if (colour == myColours.orange)
+
+    slot[0] = character + 1; // 0 = empty
+    slot[1] = parity;
+    slot[2] = first;
+    slot[3] = last;
+    cache.misses++;
+}
+
+void Screen_EPD_EXT3::s_setSpan(uint16_t x1, uint16_t y1, uint16_t y2, uint8_t pattern)
+{
+    uint8_t * line = s_newImage + (uint32_t)(x1 - s_bandRow1) * s_getBufferSizeH();
+    uint16_t z1 = y1 >> 2; // 4 pixels per byte
+    uint16_t z2 = y2 >> 2;
+    uint8_t mask1 = 0xff >> ((y1 % 4) * 2);
+    uint8_t mask2 = 0xff << ((3 - (y2 % 4)) * 2);
+
+    if (z1 == z2)
+    {
+        mask1 &= mask2;
+        line[z1] = (line[z1] & ~mask1) | (pattern & mask1);
+    }
+    else
     {
-        if (flagOdd)
+        line[z1] = (line[z1] & ~mask1) | (pattern & mask1);
+        if (z2 > z1 + 1)
         {
-            colour = myColours.yellow; // yellow
+            memset(line + z1 + 1, pattern, z2 - z1 - 1);
         }
-        else
+        line[z2] = (line[z2] & ~mask2) | (pattern & mask2);
+    }
+}
+
+const colour2bpp_s & Screen_EPD_EXT3::s_resolveColour(uint16_t colour)
+{
+    // Same colour and invert as one of the last two calls, text and background colours
+    for (uint8_t index = 0; index < 2; index++)
+    {
+        if ((colour == s_colour2bpp[index].colour) and (u_invert == s_colour2bpp[index].invert))
         {
-            colour = myColours.red; // red
+            s_colourLast = index;
+            return s_colour2bpp[index];
         }
     }
 
-    // Coordinates
-    uint32_t z1 = s_getZ(x1, y1);
-    uint16_t b1 = s_getB(x1, y1);
+    // Convert combined colours into basic colours, for (x + y) even and odd
+    uint16_t colourEven = colour;
+    uint16_t colourOdd = colour;
 
-    // Basic colours
-    if ((colour == myColours.black) xor u_invert)
+    if (colour == myColours.grey)
+    {
+        colourEven = myColours.black; // black
+        colourOdd = myColours.white; // white
+    }
+    else if (colour == myColours.darkRed)
+    {
+        colourEven = myColours.red; // red
+        colourOdd = u_invert ? myColours.white : myColours.black; // black
+    }
+    else if (colour == myColours.lightRed)
+    {
+        colourEven = myColours.red; // red
+        colourOdd = u_invert ? myColours.black : myColours.white; // white
+    }
+    else if (colour == myColours.darkYellow)
     {
-        // physical white = 0-0
-        bitClear(s_newImage[z1], b1 + 1); // MSB
-        bitClear(s_newImage[z1], b1);
+        colourEven = myColours.yellow; // yellow
+        colourOdd = myColours.black; // black
     }
-    else if ((colour == myColours.white) xor u_invert)
+    else if (colour == myColours.lightYellow)
     {
-        // physical black = 0-1
-        bitClear(s_newImage[z1], b1 + 1); // MSB
-        bitSet(s_newImage[z1], b1);
+        colourEven = myColours.yellow; // yellow
+        colourOdd = myColours.white; // white
     }
-    else if (colour == myColours.yellow)
+    else if (colour == myColours.orange)
     {
-        // physical yellow = 1-0
-        bitSet(s_newImage[z1], b1 + 1); // MSB
-        bitClear(s_newImage[z1], b1);
+        colourEven = myColours.yellow; // yellow
+        colourOdd = myColours.red; // red
     }
-    else if (colour == myColours.red)
+
+    // Basic colours into 2-bit codes, invert applied once
+    uint8_t codes[2] = { 0xff, 0xff };
+    uint16_t basics[2] = { colourEven, colourOdd };
+
+    for (uint8_t i = 0; i < 2; i++)
     {
-        // physical red = 1-1
-        bitSet(s_newImage[z1], b1 + 1); // MSB
-        bitSet(s_newImage[z1], b1);
+        if ((basics[i] == myColours.black) xor u_invert)
+        {
+            codes[i] = 0b00; // physical white = 0-0
+        }
+        else if ((basics[i] == myColours.white) xor u_invert)
+        {
+            codes[i] = 0b01; // physical black = 0-1
+        }
+        else if (basics[i] == myColours.yellow)
+        {
+            codes[i] = 0b10; // physical yellow = 1-0
+        }
+        else if (basics[i] == myColours.red)
+        {
+            codes[i] = 0b11; // physical red = 1-1
+        }
     }
+
+    // Entry not used by the last call, so the previous descriptor stays valid
+    s_colourLast ^= 1;
+    colour2bpp_s & descriptor = s_colour2bpp[s_colourLast];
+
+    descriptor.colour = colour;
+    descriptor.invert = u_invert;
+    descriptor.valid = (codes[0] != 0xff) and (codes[1] != 0xff);
+    descriptor.codeEven = codes[0] & 0b11;
+    descriptor.codeOdd = codes[1] & 0b11;
+
+    // Pixels with (x + y) even first on rows with even index
+    descriptor.patternEven = (descriptor.codeEven << 6) | (descriptor.codeOdd << 4) | (descriptor.codeEven << 2) | descriptor.codeOdd;
+    descriptor.patternOdd = (descriptor.codeOdd << 6) | (descriptor.codeEven << 4) | (descriptor.codeOdd << 2) | descriptor.codeEven;
+
+    return descriptor;
 }
 
 void Screen_EPD_EXT3::s_setOrientation(uint8_t orientation)
 {
+    // Dirty area with previous orientation
+    s_foldDirty();
+
     v_orientation = orientation % 4;
+
+    // Same transformation as s_orientCoordinates(), as pixel index = row * H + column
+    // H is a multiple of 4, so the parity of column H - 1 - y is the parity of y + 1
+    int32_t sizeH = v_screenSizeH;
+    int32_t sizeV = v_screenSizeV;
+
+    switch (v_orientation)
+    {
+        case 3: // row = V - 1 - x, column = y
+
+            s_orientIndex0 = (sizeV - 1) * sizeH;
+            s_orientStepX = -sizeH;
+            s_orientStepY = 1;
+            s_orientSizeX = v_screenSizeV;
+            s_orientSizeY = v_screenSizeH;
+            s_orientParity = (sizeV + 1) % 2;
+            break;
+
+        case 2: // row = V - 1 - y, column = H - 1 - x
+
+            s_orientIndex0 = sizeV * sizeH - 1;
+            s_orientStepX = -1;
+            s_orientStepY = -sizeH;
+            s_orientSizeX = v_screenSizeH;
+            s_orientSizeY = v_screenSizeV;
+            s_orientParity = sizeV % 2;
+            break;
+
+        case 1: // row = x, column = H - 1 - y
+
+            s_orientIndex0 = sizeH - 1;
+            s_orientStepX = sizeH;
+            s_orientStepY = -1;
+            s_orientSizeX = v_screenSizeV;
+            s_orientSizeY = v_screenSizeH;
+            s_orientParity = 1;
+            break;
+
+        default: // row = y, column = x
+
+            s_orientIndex0 = 0;
+            s_orientStepX = 1;
+            s_orientStepY = sizeH;
+            s_orientSizeX = v_screenSizeH;
+            s_orientSizeY = v_screenSizeV;
+            s_orientParity = 0;
+            break;
+    }
 }
 
 bool Screen_EPD_EXT3::s_orientCoordinates(uint16_t & x, uint16_t & y)
@@ -923,22 +2513,110 @@ bool Screen_EPD_EXT3::s_orientCoordinates(uint16_t & x, uint16_t & y)
     return _flagResult;
 }
 
-uint32_t Screen_EPD_EXT3::s_getZ(uint16_t x1, uint16_t y1)
+void Screen_EPD_EXT3::s_foldDirty()
 {
-    uint32_t z1 = 0;
+    if ((s_dirtyX1 > s_dirtyX2) or (v_screenSizeH == 0))
+    {
+        return;
+    }
+
+    // Both corners with the orientation used for drawing
+    uint16_t corners[2][2] = { { s_dirtyX1, s_dirtyY1 }, { s_dirtyX2, s_dirtyY2 } };
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint32_t p1 = s_orientIndex0 + (int32_t)corners[i][0] * s_orientStepX + (int32_t)corners[i][1] * s_orientStepY;
+        uint16_t row = p1 / v_screenSizeH;
+        uint16_t column = p1 % v_screenSizeH;
+
+        s_dirtyRow1 = min(s_dirtyRow1, row);
+        s_dirtyColumn1 = min(s_dirtyColumn1, column);
+        s_dirtyRow2 = max(s_dirtyRow2, row);
+        s_dirtyColumn2 = max(s_dirtyColumn2, column);
+    }
+
+    s_dirtyX1 = 0xffff;
+    s_dirtyY1 = 0xffff;
+    s_dirtyX2 = 0;
+    s_dirtyY2 = 0;
+}
 
-    z1 = (uint32_t)x1 * u_bufferSizeH + (y1 >> 2); // 4 pixels per byte
+void Screen_EPD_EXT3::s_setDirty(bool flagAll)
+{
+    s_dirtyX1 = 0xffff;
+    s_dirtyY1 = 0xffff;
+    s_dirtyX2 = 0;
+    s_dirtyY2 = 0;
 
-    return z1;
+    if (flagAll)
+    {
+        s_dirtyRow1 = 0;
+        s_dirtyColumn1 = 0;
+        s_dirtyRow2 = v_screenSizeV - 1;
+        s_dirtyColumn2 = v_screenSizeH - 1;
+    }
+    else
+    {
+        s_dirtyRow1 = 0xffff;
+        s_dirtyColumn1 = 0xffff;
+        s_dirtyRow2 = 0;
+        s_dirtyColumn2 = 0;
+    }
 }
 
-uint16_t Screen_EPD_EXT3::s_getB(uint16_t x1, uint16_t y1)
+bool Screen_EPD_EXT3::getDirtyArea(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2)
 {
-    uint16_t b1 = 0;
+    s_foldDirty();
+    if (s_dirtyRow1 > s_dirtyRow2)
+    {
+        x1 = 0;
+        y1 = 0;
+        x2 = 0;
+        y2 = 0;
+        return false;
+    }
+
+    // Inverse of s_orientCoordinates()
+    uint16_t row1 = s_dirtyRow1;
+    uint16_t row2 = s_dirtyRow2;
+    uint16_t column1 = s_dirtyColumn1;
+    uint16_t column2 = s_dirtyColumn2;
+
+    switch (v_orientation)
+    {
+        case 3: // row = V - 1 - x, column = y
+
+            x1 = v_screenSizeV - 1 - row2;
+            x2 = v_screenSizeV - 1 - row1;
+            y1 = column1;
+            y2 = column2;
+            break;
+
+        case 2: // row = V - 1 - y, column = H - 1 - x
 
-    b1 = 6 - 2 * (y1 % 4); // 4 pixels per byte
+            x1 = v_screenSizeH - 1 - column2;
+            x2 = v_screenSizeH - 1 - column1;
+            y1 = v_screenSizeV - 1 - row2;
+            y2 = v_screenSizeV - 1 - row1;
+            break;
+
+        case 1: // row = x, column = H - 1 - y
+
+            x1 = row1;
+            x2 = row2;
+            y1 = v_screenSizeH - 1 - column2;
+            y2 = v_screenSizeH - 1 - column1;
+            break;
+
+        default: // row = y, column = x
+
+            x1 = column1;
+            x2 = column2;
+            y1 = row1;
+            y2 = row2;
+            break;
+    }
 
-    return b1;
+    return true;
 }
 
 uint16_t Screen_EPD_EXT3::s_getPoint(uint16_t x1, uint16_t y1)
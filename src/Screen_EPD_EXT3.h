@@ -18,8 +18,8 @@
 /// * EPD_417_QS_0A screen 4.17”
 ///
 /// @author Rei Vilo
-/// @date 21 Feb 2025
-/// @version 820
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -61,33 +61,55 @@
 #include "hV_Utilities_PDLS.h"
 
 // Checks
-#if (hV_HAL_PERIPHERALS_RELEASE < 812)
-#error Required hV_HAL_PERIPHERALS_RELEASE 812
+#if (hV_HAL_PERIPHERALS_RELEASE < 830)
+#error Required hV_HAL_PERIPHERALS_RELEASE 830
 #endif // hV_HAL_PERIPHERALS_RELEASE
 
 #if (hV_CONFIGURATION_RELEASE < 812)
 #error Required hV_CONFIGURATION_RELEASE 812
 #endif // hV_CONFIGURATION_RELEASE
 
-#if (hV_SCREEN_BUFFER_RELEASE < 812)
-#error Required hV_SCREEN_BUFFER_RELEASE 812
+#if (hV_SCREEN_BUFFER_RELEASE < 830)
+#error Required hV_SCREEN_BUFFER_RELEASE 830
 #endif // hV_SCREEN_BUFFER_RELEASE
 
-#if (hV_BOARD_RELEASE < 812)
-#error Required hV_BOARD_RELEASE 812
+#if (hV_BOARD_RELEASE < 830)
+#error Required hV_BOARD_RELEASE 830
 #endif // hV_BOARD_RELEASE
 
 #ifndef SCREEN_EPD_EXT3_RELEASE
 ///
 /// @brief Library release number
 ///
-#define SCREEN_EPD_EXT3_RELEASE 820
+#define SCREEN_EPD_EXT3_RELEASE 830
 
 ///
 /// @brief Library variant
 ///
 #define SCREEN_EPD_EXT3_VARIANT "Basic-BWRY"
 
+///
+/// @brief Size of the OTP cache
+/// @details Header 12 bytes, OTP table up to 112 bytes, checksum 2 bytes
+///
+#define SCREEN_EPD_EXT3_OTP_CACHE_SIZE (12 + 112 + 2)
+
+///
+/// @name Screen fixed at compile time
+/// @details Define SCREEN_EPD_EXT3_FIXED with the screen, for example eScreen_EPD_266_QS_0F,
+/// to resolve sizes, frame-buffer and COG code path at compile time
+/// * Frame-buffer in a static array, no heap allocation
+/// * Code for other screens removed by the compiler
+/// @note Set with -D at compilation or before including the library
+/// @warning Only one screen, same as the one passed to the constructor
+/// @{
+#if defined(SCREEN_EPD_EXT3_FIXED)
+#ifndef SCREEN_EPD_EXT3_FIXED_DEPTH
+#define SCREEN_EPD_EXT3_FIXED_DEPTH 1 ///< 1 = single frame-buffer, 2 = double frame-buffer
+#endif // SCREEN_EPD_EXT3_FIXED_DEPTH
+#endif // SCREEN_EPD_EXT3_FIXED
+/// @}
+
 ///
 /// @name Constants for features
 /// @{
@@ -96,6 +118,132 @@
 #define WITH_COLOURS_BWRY ///< Black-White-Red-Yellow colours
 /// @}
 
+///
+/// @name Display list
+/// @{
+#define LIST_OFF 0x00 ///< draw immediately
+#define LIST_RECORD 0x01 ///< record commands
+#define LIST_REPLAY 0x02 ///< replay commands into the frame-buffer
+
+#define LIST_ORIENTATION 0x01 ///< command, orientation
+#define LIST_CLEAR 0x02 ///< command, clear()
+#define LIST_POINT 0x03 ///< command, point
+#define LIST_AREA 0x04 ///< command, area
+#define LIST_TEXT 0x05 ///< command, gText()
+#define LIST_LINE 0x06 ///< command, line()
+#define LIST_CIRCLE 0x07 ///< command, circle()
+#define LIST_TRIANGLE 0x08 ///< command, triangle()
+#define LIST_ELLIPSE 0x09 ///< command, ellipse()
+#define LIST_ROUND 0x0a ///< command, roundRectangle()
+#define LIST_FILL 0x0b ///< command, fillPattern()
+/// @}
+
+///
+/// @brief Structure for colour descriptor
+/// @details Colour resolved once into the codes for the frame-buffer
+/// * 2-bit codes: 0b00 black, 0b01 white, 0b10 yellow, 0b11 red, with invert applied
+/// * Dithered colours alternate between even and odd (x + y) pixels, physical coordinates
+/// * Byte patterns: four pixels, for rows with even and odd index
+///
+struct colour2bpp_s
+{
+    uint16_t colour; ///< 16-bit colour
+    bool invert; ///< invert flag
+    bool valid; ///< false if colour not supported
+    uint8_t codeEven; ///< 2-bit code for (x + y) even
+    uint8_t codeOdd; ///< 2-bit code for (x + y) odd
+    uint8_t patternEven; ///< four pixels for row with even index
+    uint8_t patternOdd; ///< four pixels for row with odd index
+};
+
+///
+/// @brief Structure for glyph cache
+/// @details Glyphs of the selected font expanded into the frame-buffer layout
+/// * Slot: header with character, parity and columns drawn, then 2-bit codes and masks, physical rows
+/// * Context: font, colours, solid, invert and orientation, slots emptied when changed
+///
+struct glyphCache_s
+{
+    uint8_t * buffer; ///< caller-provided storage, nullptr if disabled
+    uint32_t size; ///< size of the buffer, in bytes
+    uint16_t slots; ///< number of slots, direct-mapped
+    uint16_t slotSize; ///< size of one slot, in bytes
+    bool valid; ///< false if context to be set
+    uint8_t fontSize; ///< context, selected font
+    uint16_t textColour; ///< context, text colour
+    uint16_t backColour; ///< context, background colour
+    bool solid; ///< context, font solid
+    bool invert; ///< context, invert flag
+    uint8_t orientation; ///< context, orientation
+    uint8_t rows; ///< physical rows of a glyph
+    uint8_t columns; ///< physical columns of a glyph
+    uint8_t bytes; ///< bytes per physical row, 4 pixels per byte
+    bool full; ///< masks all set, rows copied as is
+    int8_t rowX, columnX; ///< physical steps for one step along x-axis
+    int8_t rowY, columnY; ///< physical steps for one step along y-axis
+    uint8_t row0, column0; ///< physical offsets of the top-left corner in the slot
+    uint32_t hits; ///< glyphs found in the cache
+    uint32_t misses; ///< glyphs expanded into the cache
+};
+
+///
+/// @brief Vertical size of the screen
+/// @param eScreen screen
+/// @return vertical = wide size, 0 if not supported
+/// @note Resolved at compile time for a constant screen
+///
+constexpr uint16_t screenSizeV_EPD_EXT3(eScreen_EPD_t eScreen)
+{
+    return (SCREEN_SIZE(eScreen) == SIZE_154) ? 152 :
+           (SCREEN_SIZE(eScreen) == SIZE_213) ? 212 :
+           (SCREEN_SIZE(eScreen) == SIZE_266) ? 296 :
+           (SCREEN_SIZE(eScreen) == SIZE_417) ? 300 : 0;
+}
+
+///
+/// @brief Horizontal size of the screen
+/// @param eScreen screen
+/// @return horizontal = small size, 0 if not supported
+/// @note Resolved at compile time for a constant screen
+///
+constexpr uint16_t screenSizeH_EPD_EXT3(eScreen_EPD_t eScreen)
+{
+    return (SCREEN_SIZE(eScreen) == SIZE_154) ? 152 :
+           (SCREEN_SIZE(eScreen) == SIZE_213) ? 104 :
+           (SCREEN_SIZE(eScreen) == SIZE_266) ? 152 :
+           (SCREEN_SIZE(eScreen) == SIZE_417) ? 400 : 0;
+}
+
+///
+/// @brief Size of one frame-buffer
+/// @param eScreen screen
+/// @return number of bytes, 2 bits per pixel
+/// @note Resolved at compile time for a constant screen
+///
+constexpr uint32_t pageSize_EPD_EXT3(eScreen_EPD_t eScreen)
+{
+    return (uint32_t)screenSizeV_EPD_EXT3(eScreen) * (screenSizeH_EPD_EXT3(eScreen) / 4);
+}
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+///
+/// @brief Structure for statistics of the last update
+/// @details Durations in us, each including the wait for the panel
+///
+struct flushStats_s
+{
+    uint32_t count; ///< number of updates since begin()
+    uint32_t resume; ///< resume(), GPIOs, reset, OTP and SPI
+    uint32_t initial; ///< COG initial
+    uint32_t send; ///< image sent and power on
+    uint32_t refresh; ///< refresh, busy wait
+    uint32_t powerOff; ///< power off and restore
+    uint32_t total; ///< total update
+    uint32_t bytes; ///< bytes sent over SPI
+    uint32_t polls; ///< polls of panelBusy
+};
+#endif // DEBUG_MODE
+
 // Objects
 //
 ///
@@ -122,11 +270,113 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
 
     ///
     /// @brief Initialisation
-    /// @note Frame-buffer generated internally, not suitable for FRAM
+    /// @note Frame-buffer generated internally, not suitable for FRAM, unless set by setFrameBuffer()
     /// @warning begin() initialises SPI and I2C
     ///
     void begin();
 
+    ///
+    /// @brief Initialisation, with deferred panel bring-up
+    /// @details Frame-buffer, fonts and orientation ready for drawing,
+    /// GPIOs, reset, OTP read and SPI performed by resume() at the first update
+    /// @note begin() = beginLazy() + resume()
+    /// @note Call resume() to bring the panel up earlier, for example in parallel with sensors
+    ///
+    void beginLazy();
+
+    ///
+    /// @brief End
+    /// @details Complete the update in progress, suspend the panel and release the frame-buffer
+    /// @note Frame-buffer released only if allocated by begin()
+    /// @note Call begin() again to use the screen
+    ///
+    void end();
+
+    ///
+    /// @brief Set the frame-buffer
+    /// @param buffer frame-buffer, owned by the caller
+    /// @param size size of the frame-buffer, bytes
+    /// @note Size given by requiredBufferSize(), twice the size for double frame-buffer
+    /// @note For example, static array in a specific RAM bank, no heap allocation
+    /// @warning To be called before begin()
+    ///
+    void setFrameBuffer(uint8_t * buffer, uint32_t size);
+
+    ///
+    /// @brief Set the band buffer for banded rendering
+    /// @param buffer band buffer, owned by the caller
+    /// @param size size of the band buffer, bytes, at least two rows of the frame-buffer
+    /// @details The band buffer holds an even number of rows of the frame-buffer, instead of the full frame-buffer
+    /// @note Update with flushBands(), flush() is skipped unless a display list is set
+    /// @warning To be called before begin()
+    ///
+    void setBandBuffer(uint8_t * buffer, uint32_t size);
+
+    ///
+    /// @brief Update the display with banded rendering
+    /// @details The scene is drawn once per band, each band sent before drawing the next one
+    /// @param draw function drawing the whole scene with the standard functions, clipped to the band
+    /// @return uint8_t recommended mode
+    /// @note Requires setBandBuffer(), otherwise one band for the whole screen
+    /// @note Peak RAM proportional to the height of the band
+    ///
+    uint8_t flushBands(void (*draw)());
+
+    ///
+    /// @brief Set display list
+    /// @param buffer caller-provided storage for the commands, nullptr to disable
+    /// @param size size of the buffer, in bytes
+    /// @details With a display list, clear(), gText() and the graphics functions record
+    /// commands instead of drawing. flush() replays the commands into the frame-buffer,
+    /// band by band with a band buffer.
+    /// @note The list is kept after flush(), so the same layout is replayed by the next flush()
+    /// @note With the full frame-buffer, the list is replayed only if it has changed since the last flush(),
+    /// so an unchanged list skips the update
+    /// @note Commands of 3 to 16 bytes, 12 bytes plus one per character for gText()
+    ///
+    void setDisplayList(uint8_t * buffer, uint32_t size);
+
+    ///
+    /// @brief Empty the display list
+    /// @note Next commands recorded from the start
+    ///
+    void clearDisplayList();
+
+    ///
+    /// @brief Get last command of the display list
+    /// @return handle of the last command, for setDisplayListText()
+    ///
+    uint32_t getDisplayListLast();
+
+    ///
+    /// @brief Change the text of a gText() command
+    /// @param handle handle of the command from getDisplayListLast()
+    /// @param text new text, padded with spaces or truncated to the length recorded
+    /// @return true if successful, false if the handle is not the start of a gText() command
+    /// @note Replayed by the next flush(), without recording the layout again
+    /// @note The list changes only if the text is different
+    ///
+    bool setDisplayListText(uint32_t handle, String text);
+
+    ///
+    /// @brief Get size of the display list
+    /// @param[out] count number of commands
+    /// @param[out] used number of bytes used
+    ///
+    void getDisplayListSize(uint16_t & count, uint32_t & used);
+
+    ///
+    /// @brief Size required for the frame-buffer
+    /// @param eScreen screen
+    /// @param depth number of frame-buffers, default = 1, 2 for double frame-buffer
+    /// @return number of bytes, 0 if screen not supported
+    /// @note Resolved at compile time for a constant screen
+    ///
+    static constexpr uint32_t requiredBufferSize(eScreen_EPD_t eScreen, uint8_t depth = 1)
+    {
+        return pageSize_EPD_EXT3(eScreen) * depth;
+    }
+
     ///
     /// @brief Suspend
     /// @param suspendScope default = POWER_SCOPE_GPIO_ONLY, otherwise POWER_SCOPE_NONE
@@ -151,9 +401,95 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
     /// @brief Clear the screen
     /// @param colour default = white
     /// @note Clear next frame-buffer
+    /// @note Since release 830, the dithered colours start with the same phase as point(),
+    /// so grey, dark and light red, dark and light yellow, and orange are shifted by one pixel
+    /// compared with previous releases
     ///
     void clear(uint16_t colour = myColours.white);
 
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text text string
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note Recorded as one command with a display list
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gText(uint16_t x0, uint16_t y0,
+               String text,
+               uint16_t textColour = myColours.black,
+               uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw line, rectangle coordinates
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Recorded as one command with a display list
+    ///
+    void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Draw circle
+    /// @param x0 center, point coordinate, x-axis
+    /// @param y0 center, point coordinate, y-axis
+    /// @param radius radius
+    /// @param colour 16-bit colour
+    /// @note Recorded as one command with a display list
+    ///
+    void circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour);
+
+    ///
+    /// @brief Draw triangle, rectangle coordinates
+    /// @param x1 first point coordinate, x-axis
+    /// @param y1 first point coordinate, y-axis
+    /// @param x2 second point coordinate, x-axis
+    /// @param y2 second point coordinate, y-axis
+    /// @param x3 third point coordinate, x-axis
+    /// @param y3 third point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Recorded as one command with a display list
+    ///
+    void triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
+
+    ///
+    /// @brief Draw ellipse
+    /// @param x0 center, point coordinate, x-axis
+    /// @param y0 center, point coordinate, y-axis
+    /// @param radiusX radius, x-axis
+    /// @param radiusY radius, y-axis
+    /// @param colour 16-bit colour
+    /// @note Recorded as one command with a display list
+    ///
+    void ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour);
+
+    ///
+    /// @brief Draw rectangle with rounded corners, rectangle coordinates
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param radius radius of the corners
+    /// @param colour 16-bit colour
+    /// @note Recorded as one command with a display list
+    ///
+    void roundRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour);
+
+    ///
+    /// @brief Fill the screen with a pattern
+    /// @param patternEven byte for rows with even index, four pixels
+    /// @param patternOdd byte for rows with odd index, four pixels
+    /// @note Fill next frame-buffer, physical coordinates
+    /// @note 2-bit codes: 0b00 black, 0b01 white, 0b10 yellow, 0b11 red, invert not applied
+    /// @note Recorded with a display list
+    ///
+    void fillPattern(uint8_t patternEven, uint8_t patternOdd);
+
     ///
     /// @brief Update the display, global update
     /// @note
@@ -178,6 +514,131 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
     ///
     uint8_t flushMode(uint8_t updateMode = UPDATE_GLOBAL);
 
+    ///
+    /// @brief Get the area changed since last flush()
+    /// @param[out] x1 top left coordinate, x-axis
+    /// @param[out] y1 top left coordinate, y-axis
+    /// @param[out] x2 bottom right coordinate, x-axis
+    /// @param[out] y2 bottom right coordinate, y-axis
+    /// @return true if the frame-buffer has changed, false otherwise
+    /// @note Coordinates for the current orientation
+    /// @note flush() and flushMode() are skipped if the frame-buffer has not changed
+    /// @note The Spectra 4 COG refreshes the full screen, so the full frame-buffer is sent
+    /// @n @b More: @ref Coordinate
+    ///
+    bool getDirtyArea(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2);
+
+    ///
+    /// @brief Skip identical frames
+    /// @param flag default = true, enable; false = disable
+    /// @details Keep the hash of the last frame sent, and skip flush() and flushMode()
+    /// if the frame-buffer is identical, with UPDATE_NONE returned
+    /// @note Disabled by default, counters reset
+    ///
+    void setFrameHash(bool flag = true);
+
+    ///
+    /// @brief Get counters for identical frames
+    /// @param[out] skipped number of flush() skipped, frame identical
+    /// @param[out] sent number of flush() sent, frame different
+    ///
+    void getFrameHashCounters(uint32_t & skipped, uint32_t & sent);
+
+    ///
+    /// @brief Set glyph cache
+    /// @param buffer caller-provided storage, nullptr to disable
+    /// @param size size of the buffer, in bytes
+    /// @details Keep the glyphs drawn by gText() expanded into the frame-buffer layout,
+    /// for the selected font, colours and orientation
+    /// * Glyph at a position multiple of 4 pixels: rows copied
+    /// * Otherwise: rows shifted and merged
+    /// @note Disabled by default, counters reset
+    /// @note One slot per glyph, direct-mapped on character and parity;
+    /// slot of 4 + 2 * rows * bytes per row, as 100 bytes for Font_Terminal8x12
+    /// @note Glyphs crossing the edges of the screen or the band drawn column by column
+    ///
+    void setGlyphCache(uint8_t * buffer, uint32_t size);
+
+    ///
+    /// @brief Get counters for glyph cache
+    /// @param[out] hits number of glyphs found in the cache
+    /// @param[out] misses number of glyphs expanded into the cache
+    ///
+    void getGlyphCacheCounters(uint32_t & hits, uint32_t & misses);
+
+    ///
+    /// @brief Update the display, asynchronous
+    /// @details Start the update and return at the first wait for the panel
+    /// @param updateMode expected update mode, default = UPDATE_GLOBAL
+    /// @return uint8_t recommended mode, UPDATE_NONE if skipped or already in progress
+    /// @note Same checks as flushMode()
+    /// @note Advance the update with isBusy() from loop()
+    /// @warning Frame-buffer not to be modified before the image is sent
+    ///
+    uint8_t flushAsync(uint8_t updateMode = UPDATE_GLOBAL);
+
+    ///
+    /// @brief Check and advance the asynchronous update
+    /// @return true if update in progress, false otherwise
+    /// @details Perform the next steps of the update when the panel is ready
+    /// @note Call from loop(), or after an interrupt on panelBusy has set a flag,
+    /// as SPI is not to be used in interrupt context
+    ///
+    bool isBusy();
+
+    ///
+    /// @brief Set callback for end of asynchronous update
+    /// @param callback function with update mode as parameter, nullptr to disable
+    ///
+    void setFlushCallback(void (*callback)(uint8_t updateMode));
+
+    ///
+    /// @brief Set double frame-buffer
+    /// @param flag default = true, two frame-buffers; false = one frame-buffer
+    /// @details With two frame-buffers, the update sends the front frame-buffer
+    /// while drawing continues on the back frame-buffer
+    /// @note Front and back frame-buffers swapped at start of update,
+    /// back frame-buffer initialised with the image sent
+    /// @warning To be called before begin()
+    ///
+    void setDoubleBuffer(bool flag = true);
+
+    ///
+    /// @brief Export the OTP table
+    /// @param[out] buffer caller-provided storage, as RTC RAM, EEPROM or file
+    /// @param size size of the buffer, at least SCREEN_EPD_EXT3_OTP_CACHE_SIZE
+    /// @return number of bytes written, 0 if OTP not read yet or buffer too small
+    /// @note Screen, chip identifier, OTP table and checksum
+    ///
+    uint16_t exportOTP(uint8_t * buffer, uint16_t size);
+
+    ///
+    /// @brief Import the OTP table
+    /// @param buffer data from exportOTP()
+    /// @param size size of the data
+    /// @return true if valid and imported, false otherwise
+    /// @details A valid table skips the 3-wire SPI read of the OTP memory
+    /// @note To be called before begin()
+    /// @note Checks screen, chip identifier, length and checksum
+    ///
+    bool importOTP(const uint8_t * buffer, uint16_t size);
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    ///
+    /// @brief Get statistics of the last update
+    /// @return structure with durations, bytes and polls
+    /// @note Requires DEBUG_MODE = USE_DEBUG_STATS
+    ///
+    const flushStats_s & getFlushStats();
+
+    ///
+    /// @brief Set trace callback for each step of the update
+    /// @param callback function with step FLUSH_* and duration in us, nullptr to disable
+    /// @note Requires DEBUG_MODE = USE_DEBUG_STATS
+    ///
+    void setFlushTrace(void (*callback)(uint8_t step, uint32_t duration));
+#endif // DEBUG_MODE
+
   protected:
     /// @cond
 
@@ -213,6 +674,121 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
     ///
     uint16_t s_getPoint(uint16_t x1, uint16_t y1);
 
+    /// @brief Set area
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are sorted, x1 <= x2 and y1 <= y2
+    /// @note Clipped and oriented once, then filled with s_setSpan()
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set column of a glyph
+    /// @param x1 coordinate, x-axis
+    /// @param y1 top coordinate, y-axis
+    /// @param bits one bit per pixel, bit 0 at y1
+    /// @param height number of pixels, up to 32
+    /// @param textColour 16-bit colour for bits set
+    /// @param backColour 16-bit colour for bits cleared
+    /// @param flagSolid true = bits cleared with backColour, false = unchanged
+    /// @note Colours resolved and column oriented once, then written pixel by pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void s_setColumn(uint16_t x1, uint16_t y1, uint32_t bits, uint8_t height, uint16_t textColour, uint16_t backColour, bool flagSolid);
+
+    ///
+    /// @brief Set character of the selected font
+    /// @param x0 left coordinate, x-axis
+    /// @param y0 top coordinate, y-axis
+    /// @param character character index, ASCII code - 32
+    /// @param textColour 16-bit colour for the glyph
+    /// @param backColour 16-bit colour for the background, if font solid
+    /// @note With glyph cache, glyph copied or merged row by row,
+    /// otherwise column by column
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void s_setCharacter(uint16_t x0, uint16_t y0, uint8_t character, uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief Check the context of the glyph cache
+    /// @param textColour 16-bit colour for the glyph
+    /// @param backColour 16-bit colour for the background
+    /// @return true if the cache is usable, false otherwise
+    /// @note Slots emptied when the context changes
+    ///
+    bool s_checkGlyphCache(uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief Expand a glyph into a slot of the glyph cache
+    /// @param slot slot of the glyph cache
+    /// @param character character index, ASCII code - 32
+    /// @param parity (x0 + y0) parity of the glyph
+    ///
+    void s_expandGlyph(uint8_t * slot, uint8_t character, uint8_t parity);
+
+    ///
+    /// @brief Set span on one row of the frame-buffer
+    /// @param x1 row, physical coordinate
+    /// @param y1 first pixel, physical coordinate
+    /// @param y2 last pixel, physical coordinate, y1 <= y2
+    /// @param pattern four 2-bit codes for four consecutive pixels
+    /// @note Whole bytes for the body, masked head and tail bytes
+    ///
+    void s_setSpan(uint16_t x1, uint16_t y1, uint16_t y2, uint8_t pattern);
+
+    ///
+    /// @brief Resolve colour into descriptor
+    /// @param colour 16-bit colour
+    /// @return descriptor with 2-bit codes and byte patterns
+    /// @note Last two descriptors kept, so text and background colours alternate without conversion
+    /// @note Descriptor returned by previous call still valid
+    ///
+    const colour2bpp_s & s_resolveColour(uint16_t colour);
+
+    ///
+    /// @brief Screen
+    /// @return SCREEN_EPD_EXT3_FIXED if defined, u_eScreen_EPD otherwise
+    /// @note Constant screen removes the code for other screens
+    ///
+    inline eScreen_EPD_t s_getScreen()
+    {
+#if defined(SCREEN_EPD_EXT3_FIXED)
+        return SCREEN_EPD_EXT3_FIXED;
+#else
+        return u_eScreen_EPD;
+#endif // SCREEN_EPD_EXT3_FIXED
+    }
+
+    ///
+    /// @brief Number of bytes per row of the frame-buffer
+    /// @return SCREEN_EPD_EXT3_FIXED constant if defined, u_bufferSizeH otherwise
+    ///
+    inline uint16_t s_getBufferSizeH()
+    {
+#if defined(SCREEN_EPD_EXT3_FIXED)
+        return screenSizeH_EPD_EXT3(SCREEN_EPD_EXT3_FIXED) / 4;
+#else
+        return u_bufferSizeH;
+#endif // SCREEN_EPD_EXT3_FIXED
+    }
+
+    ///
+    /// @brief Size of one frame-buffer
+    /// @return SCREEN_EPD_EXT3_FIXED constant if defined, u_pageColourSize otherwise
+    ///
+    inline uint32_t s_getPageSize()
+    {
+#if defined(SCREEN_EPD_EXT3_FIXED)
+        return pageSize_EPD_EXT3(SCREEN_EPD_EXT3_FIXED);
+#else
+        return u_pageColourSize;
+#endif // SCREEN_EPD_EXT3_FIXED
+    }
+
     ///
     /// @brief Reset the screen
     ///
@@ -229,22 +805,186 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
     ///
     void s_flush(uint8_t updateMode = UPDATE_GLOBAL);
 
-    // Position
     ///
-    /// @brief Convert
-    /// @param x1 x-axis coordinate
-    /// @param y1 y-axis coordinate
-    /// @return index for s_newImage[]
+    /// @brief Check the update can proceed
+    /// @param updateMode expected update mode
+    /// @return uint8_t recommended mode, UPDATE_NONE if frame-buffer unchanged
+    /// @note Checks dirty area, hash of identical frames and temperature
+    ///
+    uint8_t s_checkFlush(uint8_t updateMode);
+
+    ///
+    /// @brief Perform the steps of the update
+    /// @param flagWait true = wait for the panel, false = return when the panel is busy
+    ///
+    void s_flushStep(bool flagWait);
+
+    ///
+    /// @brief Swap front and back frame-buffers
+    /// @note Only with double frame-buffer
+    ///
+    void s_swapBuffers();
+
+    // Double frame-buffer, s_newImage for drawing and s_sendImage for update
+    bool s_flagDoubleBuffer;
+    uint8_t * s_sendImage;
+
+    // Frame-buffers, owned if allocated by begin()
+    uint8_t * s_bufferImage;
+    uint32_t s_bufferSize;
+    bool s_flagBufferOwned;
+
+    ///
+    /// @brief Release the frame-buffer
+    /// @note Only if allocated by begin()
+    ///
+    void s_releaseBuffer();
+
+    // Banded rendering, physical rows s_bandRow1 to s_bandRow1 + s_bandRows - 1 in s_newImage
+    bool s_flagBand;
+    uint16_t s_bandHeight; // rows per band, even
+    uint16_t s_bandRow1, s_bandRows;
+    uint32_t s_bandStart, s_bandSize; // bytes
+    void (*s_bandDraw)();
+
+    ///
+    /// @brief Select the band
+    /// @param row1 first physical row of the band, multiple of s_bandHeight
+    ///
+    void s_setBand(uint16_t row1);
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    ///
+    /// @brief Record the duration of the previous step
+    /// @param step next step
+    ///
+    void s_statsRecord(uint8_t step);
+
+    flushStats_s s_stats;
+    uint8_t s_statsStep;
+    uint32_t s_statsChrono, s_statsStart;
+    void (*s_statsTrace)(uint8_t step, uint32_t duration);
+#endif // DEBUG_MODE
+
+    // Asynchronous update
+    uint8_t s_flushState, s_flushMode;
+    bool s_flagFlushAsync;
+    uint32_t s_flushChrono;
+    void (*s_flushCallback)(uint8_t updateMode);
+
+    colour2bpp_s s_colour2bpp[2]; // last two resolved colours
+    uint8_t s_colourLast; // entry of the last resolved colour
+
+    // Glyph cache, caller-provided storage
+    glyphCache_s s_glyphCache;
+
+    // Display list, commands in caller-provided storage
+    uint8_t * s_listBuffer;
+    uint32_t s_listSize, s_listUsed, s_listLast; // bytes
+    uint16_t s_listCount;
+    uint8_t s_listState; // LIST_OFF, LIST_RECORD or LIST_REPLAY
+    uint8_t s_listOrientation; // orientation of the last command, 0xff = none
+    bool s_flagListFull;
+    bool s_flagListChanged; // frame-buffer to be replayed from the list
+    bool s_listInvert; // invert of the last replay
+
+    ///
+    /// @brief Reserve a command in the display list
+    /// @param size size of the command, in bytes
+    /// @return pointer to the command, nullptr if the list is full
+    /// @note Orientation command inserted if the orientation has changed
+    ///
+    uint8_t * s_listReserve(uint16_t size);
+
+    ///
+    /// @brief Record a graphic command in the display list
+    /// @param type command LIST_LINE to LIST_ROUND
+    /// @param number number of coordinates
+    /// @param values coordinates
+    /// @param colour 16-bit colour
+    /// @note Pen solid recorded with the command
+    ///
+    void s_listShape(uint8_t type, uint8_t number, const uint16_t * values, uint16_t colour);
+
+    ///
+    /// @brief Size of a command of the display list
+    /// @param command pointer to the command
+    /// @return size of the command, in bytes, 0 if unknown
+    ///
+    uint16_t s_listCommandSize(const uint8_t * command);
+
+    ///
+    /// @brief Replay the display list into the frame-buffer
+    /// @note Commands outside the band skipped
+    ///
+    void s_listReplay();
+
+    ///
+    /// @brief Check area against the band
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @return true if the area is on screen and crosses the band
+    ///
+    bool s_listInBand(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+    ///
+    /// @brief Write 16-bit value, little endian
+    ///
+    inline void s_listPut16(uint8_t * pointer, uint16_t value)
+    {
+        pointer[0] = value;
+        pointer[1] = value >> 8;
+    }
+
+    ///
+    /// @brief Read 16-bit value, little endian
+    ///
+    inline uint16_t s_listGet16(const uint8_t * pointer)
+    {
+        return pointer[0] | (pointer[1] << 8);
+    }
+
+    // Orientation folded with addressing, set by s_setOrientation()
+    // pixel index = s_orientIndex0 + x * s_orientStepX + y * s_orientStepY
+    int32_t s_orientIndex0, s_orientStepX, s_orientStepY;
+    uint16_t s_orientSizeX, s_orientSizeY; // logical limits
+    uint8_t s_orientParity; // (x + y) parity offset, logical to physical
+
+    // Area changed since last flush(), empty if first > last
+    uint16_t s_dirtyX1, s_dirtyY1, s_dirtyX2, s_dirtyY2; // logical, current orientation
+    uint16_t s_dirtyRow1, s_dirtyColumn1, s_dirtyRow2, s_dirtyColumn2; // physical
+
+    ///
+    /// @brief Fold logical dirty area into physical dirty area
+    /// @note Called before orientation changes
+    ///
+    void s_foldDirty();
+
+    ///
+    /// @brief Set dirty area
+    /// @param flagAll true = full screen, false = empty
+    ///
+    void s_setDirty(bool flagAll);
+
+    // Hash of last frame sent
+    bool s_flagHash, s_flagHashValid;
+    uint32_t s_hash, s_hashSkipped, s_hashSent;
+
+    ///
+    /// @brief Hash of the frame-buffer
+    /// @return FNV-1a hash, 32-bit words
     ///
-    uint32_t s_getZ(uint16_t x1, uint16_t y1);
+    uint32_t s_getFrameHash();
 
     ///
-    /// @brief Convert
-    /// @param x1 x-axis coordinate
-    /// @param y1 y-axis coordinate
-    /// @return bit for s_newImage[]
+    /// @brief Checksum for the OTP cache
+    /// @param data pointer to the bytes
+    /// @param size number of bytes
+    /// @return Fletcher-16 checksum
     ///
-    uint16_t s_getB(uint16_t x1, uint16_t y1);
+    uint16_t s_getChecksum(const uint8_t * data, uint16_t size);
 
     //
     // === Energy section
@@ -259,10 +999,15 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer, public hV_Utilities_PDLS
 
     void COG_SmallQ_reset();
     void COG_SmallQ_getDataOTP();
+    bool COG_SmallQ_getTypeOTP(uint16_t & chipId, uint16_t & readBytes);
+    // Steps without wait, b_waitBusy() before next step
     void COG_SmallQ_initial();
     void COG_SmallQ_sendImageData();
+    void COG_SmallQ_powerOn();
     void COG_SmallQ_update();
     void COG_SmallQ_powerOff();
+    uint32_t COG_SmallQ_getRestoreDelay();
+    void COG_SmallQ_restore();
 
     //
     // === Touch section
@@ -15,6 +15,11 @@
 // Release 801: Improved double-panel screen management
 // Release 804: Improved power management
 // Release 810: Added support for EXT4
+// Release 830: Added SPI block transfer for data
+// Release 830: Added statistics for debug
+// Release 830: Added busy wait strategies
+// Release 830: Added data sent in several blocks
+// Release 830: Added pins of the board for the Linux host
 //
 
 // Library header
@@ -31,6 +36,11 @@ void hV_Board::b_begin(pins_t board, uint8_t family, uint16_t delayCS)
     b_family = family;
     b_delayCS = delayCS;
     b_fsmPowerScreen = FSM_OFF;
+
+#if defined(hV_HAL_LINUX)
+    // Virtual panel connected to the pins of the board
+    myVirtualPanel.setPins(board.panelBusy, board.panelDC, board.panelReset, board.panelCS);
+#endif // hV_HAL_LINUX
 }
 
 void hV_Board::setPanelPowerPin(uint8_t panelPowerPin)
@@ -38,6 +48,11 @@ void hV_Board::setPanelPowerPin(uint8_t panelPowerPin)
     b_pin.panelPower = panelPowerPin;
 }
 
+void hV_Board::setBusyWait(uint8_t strategy)
+{
+    b_pin.panelBusyWait = strategy;
+}
+
 void hV_Board::b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5)
 {
     delay(ms1); // Wait for power stabilisation
@@ -54,10 +69,11 @@ void hV_Board::b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, u
 void hV_Board::b_waitBusy(bool state)
 {
     // LOW = busy, HIGH = ready
-    while (digitalRead(b_pin.panelBusy) != state)
-    {
-        delay(32); // non-blocking
-    }
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countPolls += waitFor(b_pin.panelBusy, state, b_pin.panelBusyWait);
+#else
+    waitFor(b_pin.panelBusy, state, b_pin.panelBusyWait);
+#endif // DEBUG_MODE
 }
 
 void hV_Board::b_suspend()
@@ -169,6 +185,10 @@ void hV_Board::b_resume()
 
 void hV_Board::b_sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 1 + size;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     digitalWrite(b_pin.panelCS, LOW); // CS High = Select Master
 
@@ -179,10 +199,7 @@ void hV_Board::b_sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
     delayMicroseconds(b_delayCS);
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data); // b_sendIndexFixed
-    }
+    b_sendFixed(data, size); // b_sendIndexFixed
     delayMicroseconds(b_delayCS);
 
     digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect
@@ -190,6 +207,10 @@ void hV_Board::b_sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
 
 void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size, uint8_t select)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 1 + size;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     b_select(select); // Select half of large screen
 
@@ -200,10 +221,7 @@ void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
     delayMicroseconds(b_delayCS); // Longer delay for large screens
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data); // b_sendIndexFixed
-    }
+    b_sendFixed(data, size); // b_sendIndexFixed
     delayMicroseconds(b_delayCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect Master
@@ -213,8 +231,24 @@ void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size
     }
 }
 
+void hV_Board::b_sendFixed(uint8_t data, uint32_t size)
+{
+    uint8_t buffer[32];
+    memset(buffer, data, sizeof(buffer));
+
+    while (size > 0)
+    {
+        uint32_t chunk = min(size, (uint32_t)sizeof(buffer));
+        hV_HAL_SPI_transferBlock(buffer, chunk);
+        size -= chunk;
+    }
+}
 void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 1 + size;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // DC Low
     digitalWrite(b_pin.panelCS, LOW); // CS Low
     if (b_family == FAMILY_LARGE)
@@ -248,10 +282,7 @@ void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t siz
         }
     }
     delayMicroseconds(b_delayCS);
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data[i]);
-    }
+    hV_HAL_SPI_transferBlock(data, size);
     delayMicroseconds(b_delayCS);
     digitalWrite(b_pin.panelCS, HIGH); // CS High
     if (b_family == FAMILY_LARGE)
@@ -265,9 +296,27 @@ void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t siz
     delayMicroseconds(b_delayCS);
 }
 
+void hV_Board::b_sendData(const uint8_t * data, uint32_t size)
+{
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += size;
+#endif // DEBUG_MODE
+
+    digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
+    digitalWrite(b_pin.panelCS, LOW); // CS Low
+    delayMicroseconds(b_delayCS);
+    hV_HAL_SPI_transferBlock(data, size);
+    delayMicroseconds(b_delayCS);
+    digitalWrite(b_pin.panelCS, HIGH); // CS High
+}
+
 // Software SPI Master protocol setup
 void hV_Board::b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 1 + size;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     b_select(select); // Select half of large screen
 
@@ -278,10 +327,7 @@ void hV_Board::b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
     delayMicroseconds(b_delayCS); // Longer delay for large screens
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data[i]);
-    }
+    hV_HAL_SPI_transferBlock(data, size);
     delayMicroseconds(b_delayCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelCS, HIGH); // CS high = Unselect Master
@@ -332,6 +378,10 @@ void hV_Board::b_select(uint8_t select)
 
 void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t select)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 2;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // LOW = command
     b_select(select); // Select half of large screen
 
@@ -349,6 +399,10 @@ void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t s
 
 void hV_Board::b_sendCommand8(uint8_t command)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 1;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW);
     digitalWrite(b_pin.panelCS, LOW);
 
@@ -359,6 +413,10 @@ void hV_Board::b_sendCommand8(uint8_t command)
 
 void hV_Board::b_sendCommandData8(uint8_t command, uint8_t data)
 {
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    b_countBytes += 2;
+#endif // DEBUG_MODE
+
     digitalWrite(b_pin.panelDC, LOW); // LOW = command
     digitalWrite(b_pin.panelCS, LOW);
 
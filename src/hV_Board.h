@@ -8,8 +8,8 @@
 /// * Edition: Advanced
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -44,7 +44,7 @@
 ///
 /// @brief Library release number
 ///
-#define hV_BOARD_RELEASE 812
+#define hV_BOARD_RELEASE 830
 
 // Objects
 //
@@ -71,6 +71,14 @@ class hV_Board
     ///
     void setPanelPowerPin(uint8_t panelPowerPin = NOT_CONNECTED);
 
+    ///
+    /// @brief Set the busy wait strategy
+    /// @param strategy default = BUSY_WAIT_POLL, otherwise BUSY_WAIT_INTERRUPT or BUSY_WAIT_YIELD
+    /// @note Overrides panelBusyWait of the board configuration
+    /// @note BUSY_WAIT_INTERRUPT falls back to BUSY_WAIT_POLL if panelBusy has no interrupt
+    ///
+    void setBusyWait(uint8_t strategy = BUSY_WAIT_POLL);
+
     ///
     /// @brief Get the pins of the board
     /// @return pins_t pins of the board
@@ -140,11 +148,20 @@ class hV_Board
     ///
     void b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Send data through SPI, after b_sendCommand8()
+    /// @param data data
+    /// @param size number of bytes
+    /// @note Continues the data of the last command, for data sent in several blocks
+    ///
+    void b_sendData(const uint8_t * data, uint32_t size);
+
     ///
     /// @brief Wait for ready
     /// @details Wait for panelBusy signal to reach state
     /// @note Signal is busy until reaching state
     /// @param state to reach HIGH = default, LOW
+    /// @note Strategy set by panelBusyWait
     ///
     void b_waitBusy(bool state = HIGH);
 
@@ -186,6 +203,12 @@ class hV_Board
 
     pins_t b_pin;
     uint16_t b_delayCS = 50; // ms
+
+#if defined(DEBUG_MODE) && (DEBUG_MODE == USE_DEBUG_STATS)
+    uint32_t b_countBytes = 0; // bytes sent over SPI
+    uint32_t b_countPolls = 0; // polls of panelBusy
+#endif // DEBUG_MODE
+
     uint8_t b_family;
     uint8_t b_fsmPowerScreen = FSM_OFF;
 
@@ -196,6 +219,13 @@ class hV_Board
     ///
     void b_select(uint8_t select = PANEL_CS_BOTH);
 
+    /// @brief Send the same byte repeatedly
+    /// @param data byte to send
+    /// @param size number of times
+    /// @note Blocks of bytes with hV_HAL_SPI_transferBlock()
+    ///
+    void b_sendFixed(uint8_t data, uint32_t size);
+
     /// @endcond
 };
 
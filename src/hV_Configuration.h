@@ -62,16 +62,16 @@
 #include "hV_List_Screens.h"
 
 // Checks
-#if (hV_LIST_CONSTANTS_RELEASE < 812)
-#error Required hV_LIST_CONSTANTS_RELEASE 812
+#if (hV_LIST_CONSTANTS_RELEASE < 830)
+#error Required hV_LIST_CONSTANTS_RELEASE 830
 #endif // hV_LIST_CONSTANTS_RELEASE
 
-#if (hV_LIST_OPTIONS_RELEASE < 812)
-#error Required hV_LIST_OPTIONS_RELEASE 812
+#if (hV_LIST_OPTIONS_RELEASE < 830)
+#error Required hV_LIST_OPTIONS_RELEASE 830
 #endif // hV_LIST_OPTIONS_RELEASE
 
-#if (hV_LIST_BOARDS_RELEASE < 812)
-#error Required hV_LIST_BOARDS_RELEASE 812
+#if (hV_LIST_BOARDS_RELEASE < 830)
+#error Required hV_LIST_BOARDS_RELEASE 830
 #endif // hV_LIST_BOARDS_RELEASE
 
 #if (hV_LIST_SCREENS_RELEASE < 812)
@@ -0,0 +1,864 @@
+//
+// hV_HAL_Linux.cpp
+// C++ code
+// ----------------------------------
+//
+// Project highView Library Suite
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2026
+// Licence All rights reserved
+//
+// * Basic edition: for hobbyists and for basic usage
+// Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+//
+// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+// All rights reserved
+//
+// * Commercial edition: for professionals or organisations, commercial usage
+// All rights reserved
+//
+// Release 830: Added Linux host with virtual panel
+// Release 830: Added PPM snapshot and comparison
+// Release 830: Added interrupt and sleep
+// Release 830: Added pins from the board of the screen
+// Release 830: Added comparison with reference images
+// Release 830: Added virtual clock for reproducible measures
+// Release 830: Added checks of PWR, PSR, TRES and power on against the OTP table
+//
+
+// The Arduino IDE compiles all the files, hence this condition.
+#if defined(hV_HAL_LINUX)
+
+// Library header
+#include "hV_HAL_Linux.h"
+
+// Boards
+#include "hV_List_Boards.h"
+
+// Standard libraries
+#include <chrono>
+
+//
+// === Time section
+//
+static std::chrono::steady_clock::time_point h_timeStart = std::chrono::steady_clock::now();
+static uint64_t h_timeVirtual = 0; // ns
+static bool h_timeActual = true;
+
+uint64_t hV_HAL_Linux_getTime()
+{
+    if (not h_timeActual)
+    {
+        h_timeVirtual += 1000; // 1 us per call, for loops polling the time
+        return h_timeVirtual / 1000;
+    }
+
+    uint64_t actual = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - h_timeStart).count();
+    return (actual + h_timeVirtual) / 1000;
+}
+
+void hV_HAL_Linux_setClock(bool actual)
+{
+    h_timeActual = actual;
+}
+
+void hV_HAL_Linux_addTime(uint64_t ns)
+{
+    h_timeVirtual += ns;
+}
+
+void delay(uint32_t ms)
+{
+    hV_HAL_Linux_addTime((uint64_t)ms * 1000000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    hV_HAL_Linux_addTime((uint64_t)us * 1000);
+}
+
+uint32_t millis()
+{
+    return (uint32_t)(hV_HAL_Linux_getTime() / 1000);
+}
+
+uint32_t micros()
+{
+    return (uint32_t)hV_HAL_Linux_getTime();
+}
+
+void yield()
+{
+    hV_HAL_Linux_addTime(1000); // 1 us
+}
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh)
+{
+    return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+//
+// === End of Time section
+//
+
+//
+// === GPIO section
+//
+static uint8_t h_pinState[256] = {0};
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (mode == INPUT_PULLUP)
+    {
+        h_pinState[pin] = HIGH;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t state)
+{
+    state = (state != LOW) ? HIGH : LOW;
+    if (h_pinState[pin] != state)
+    {
+        h_pinState[pin] = state;
+        myVirtualPanel.pinChanged(pin, state);
+    }
+}
+
+///
+/// @brief Attached interrupt
+///
+static struct
+{
+    uint8_t interrupt;
+    void (*isr)();
+    int mode;
+} h_interrupt = {0xff, 0, 0};
+
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode)
+{
+    h_interrupt.interrupt = interrupt;
+    h_interrupt.isr = isr;
+    h_interrupt.mode = mode;
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+    if (h_interrupt.interrupt == interrupt)
+    {
+        h_interrupt.interrupt = 0xff;
+        h_interrupt.isr = 0; // nullptr
+    }
+}
+
+void hV_HAL_Linux_sleep()
+{
+    uint64_t now = hV_HAL_Linux_getTime();
+    uint64_t until = myVirtualPanel.getBusyUntil();
+
+    if ((h_interrupt.isr != 0) and (h_interrupt.interrupt == myVirtualPanel.v_pinBusy) and (h_interrupt.mode != FALLING) and (now < until))
+    {
+        // Sleep until panelBusy rises, then wake up
+        hV_HAL_Linux_addTime((until - now + hV_HAL_LINUX_WAKE_US) * 1000);
+        h_interrupt.isr();
+    }
+    else
+    {
+        hV_HAL_Linux_addTime(1000000 - (now % 1000) * 1000); // next 1 ms tick
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (pin == myVirtualPanel.v_pinBusy)
+    {
+        hV_HAL_Linux_addTime(1000); // 1 us
+        return (myVirtualPanel.isBusy() ? LOW : HIGH); // LOW = busy, HIGH = ready
+    }
+    return h_pinState[pin];
+}
+//
+// === End of GPIO section
+//
+
+//
+// === String section
+//
+String::String(const char * text) : _text(text ? text : "") {}
+String::String(const std::string & text) : _text(text) {}
+String::String(char character) : _text(1, character) {}
+
+static std::string h_toBase(unsigned long value, bool negative, uint8_t base)
+{
+    char work[72] = {0};
+    uint8_t index = sizeof(work) - 1;
+    do
+    {
+        work[--index] = "0123456789abcdefghijklmnopqrstuvwxyz"[value % base];
+        value /= base;
+    }
+    while ((value > 0) and (index > 1));
+    if (negative)
+    {
+        work[--index] = '-';
+    }
+    return std::string(&work[index]);
+}
+
+String::String(int value, uint8_t base) : _text(h_toBase((value < 0) ? -(long)value : value, (value < 0), base)) {}
+String::String(unsigned int value, uint8_t base) : _text(h_toBase(value, false, base)) {}
+String::String(long value, uint8_t base) : _text(h_toBase((value < 0) ? -(unsigned long)value : value, (value < 0), base)) {}
+String::String(unsigned long value, uint8_t base) : _text(h_toBase(value, false, base)) {}
+
+unsigned int String::length() const
+{
+    return _text.length();
+}
+
+char String::charAt(unsigned int index) const
+{
+    return (index < _text.length()) ? _text[index] : 0;
+}
+
+const char * String::c_str() const
+{
+    return _text.c_str();
+}
+
+String String::substring(unsigned int start) const
+{
+    return substring(start, _text.length());
+}
+
+String String::substring(unsigned int start, unsigned int end) const
+{
+    if (start > end)
+    {
+        unsigned int work = start;
+        start = end;
+        end = work;
+    }
+    if (start >= _text.length())
+    {
+        return String("");
+    }
+    return String(_text.substr(start, end - start));
+}
+
+int String::indexOf(char character) const
+{
+    size_t index = _text.find(character);
+    return (index == std::string::npos) ? -1 : (int)index;
+}
+
+void String::toCharArray(char * buffer, unsigned int size) const
+{
+    if (size > 0)
+    {
+        strncpy(buffer, _text.c_str(), size - 1);
+        buffer[size - 1] = 0;
+    }
+}
+
+String & String::operator+=(const String & other)
+{
+    _text += other._text;
+    return *this;
+}
+
+String operator+(const String & a, const String & b)
+{
+    return String(a._text + b._text);
+}
+
+bool String::operator==(const String & other) const
+{
+    return (_text == other._text);
+}
+
+bool String::operator!=(const String & other) const
+{
+    return (_text != other._text);
+}
+
+char String::operator[](unsigned int index) const
+{
+    return charAt(index);
+}
+//
+// === End of String section
+//
+
+//
+// === Serial section
+//
+HardwareSerial Serial;
+
+void HardwareSerial::begin(uint32_t)
+{
+    ;
+}
+
+void HardwareSerial::flush()
+{
+    fflush(stdout);
+}
+
+size_t HardwareSerial::print(const String & text)
+{
+    return fputs(text.c_str(), stdout);
+}
+
+size_t HardwareSerial::print(const char * text)
+{
+    return fputs(text, stdout);
+}
+
+size_t HardwareSerial::print(char character)
+{
+    return fputc(character, stdout);
+}
+
+size_t HardwareSerial::print(int32_t value)
+{
+    return printf("%i", value);
+}
+
+size_t HardwareSerial::println(const String & text)
+{
+    return print(text) + println();
+}
+
+size_t HardwareSerial::println(const char * text)
+{
+    return print(text) + println();
+}
+
+size_t HardwareSerial::println(char character)
+{
+    return print(character) + println();
+}
+
+size_t HardwareSerial::println(int32_t value)
+{
+    return print(value) + println();
+}
+
+size_t HardwareSerial::println()
+{
+    return fputs("\n", stdout);
+}
+//
+// === End of Serial section
+//
+
+//
+// === Virtual panel section
+//
+hV_Virtual_Panel myVirtualPanel;
+
+hV_Virtual_Panel::hV_Virtual_Panel()
+{
+    v_pinBusy = NOT_CONNECTED;
+    v_pinDC = NOT_CONNECTED;
+    v_pinReset = NOT_CONNECTED;
+    v_pinCS = NOT_CONNECTED;
+    v_frame = 0; // nullptr
+    v_frameSize = 0;
+    v_snapshotIndex = 0;
+    v_referenceIndex = 0;
+    v_referenceFailures = 0;
+}
+
+void hV_Virtual_Panel::setPins(uint8_t pinBusy, uint8_t pinDC, uint8_t pinReset, uint8_t pinCS)
+{
+    v_pinBusy = pinBusy;
+    v_pinDC = pinDC;
+    v_pinReset = pinReset;
+    v_pinCS = pinCS;
+}
+
+void hV_Virtual_Panel::begin(uint16_t sizeCode, uint8_t pinBusy, uint8_t pinDC, uint8_t pinReset, uint8_t pinCS)
+{
+    setPins(pinBusy, pinDC, pinReset, pinCS);
+    v_sizeCode = sizeCode;
+
+    // Sizes as Screen_EPD_EXT3::begin()
+    switch (v_sizeCode)
+    {
+        case 154: // 1.54"
+
+            v_sizeV = 152;
+            v_sizeH = 152;
+            break;
+
+        case 213: // 2.13"
+
+            v_sizeV = 212;
+            v_sizeH = 104;
+            break;
+
+        case 417: // 4.17"
+
+            v_sizeV = 300;
+            v_sizeH = 400;
+            break;
+
+        default: // 2.66"
+
+            v_sizeCode = 266;
+            v_sizeV = 296;
+            v_sizeH = 152;
+            break;
+    }
+
+    v_frameSize = (uint32_t)v_sizeV * v_sizeH / 4; // 2 bits per pixel
+    delete[] v_frame;
+    v_frame = new uint8_t[v_frameSize];
+    memset(v_frame, 0x00, v_frameSize);
+
+    // OTP table, synthetic values
+    v_chipId = (v_sizeCode == 417) ? 0x0605 : 0x0302;
+    memset(v_otp, 0x00, sizeof(v_otp));
+    v_otp[0] = 0xa5; // First byte check
+    v_otp[2] = 0x86; // CoG type for 417
+    v_otp[16] = 0x07; // PWR
+    v_otp[17] = 0x0f; // PSR
+    v_otp[18] = 0x29;
+    v_otp[19] = v_sizeH >> 8; // TRES
+    v_otp[20] = v_sizeH & 0xff;
+    v_otp[21] = v_sizeV >> 8;
+    v_otp[22] = v_sizeV & 0xff;
+    if (v_sizeCode == 417)
+    {
+        v_otp[26] = 0x0f; // PSR restored after refresh
+        v_otp[27] = 0x89;
+        v_otp[43] = 0xff; // Restore required
+    }
+
+    v_command3 = 0x00;
+    v_index3 = 0;
+    v_command4 = 0x00;
+    v_index4 = 0;
+    v_busyUntil = 0;
+    v_flagPower = false;
+    v_flagPWR = false;
+    v_flagPSR = false;
+    v_flagRestore = false;
+
+    countCommands = 0;
+    countBytes = 0;
+    countRefreshes = 0;
+    countResets = 0;
+    countReadsOTP = 0;
+    countErrors = 0;
+}
+
+const uint8_t * hV_Virtual_Panel::getFrame()
+{
+    return v_frame;
+}
+
+uint32_t hV_Virtual_Panel::getFrameSize()
+{
+    return v_frameSize;
+}
+
+void hV_Virtual_Panel::getSize(uint16_t & sizeV, uint16_t & sizeH)
+{
+    sizeV = v_sizeV;
+    sizeH = v_sizeH;
+}
+
+// Physical colours for 2-bit codes 0b00 black, 0b01 white, 0b10 yellow, 0b11 red
+static const uint8_t h_colourRGB[4][3] = { { 0x00, 0x00, 0x00 }, { 0xff, 0xff, 0xff }, { 0xff, 0xff, 0x00 }, { 0xff, 0x00, 0x00 } };
+
+bool hV_Virtual_Panel::savePPM(const char * fileName, const uint8_t * frame)
+{
+    if (frame == 0)
+    {
+        frame = v_frame;
+    }
+
+    FILE * file = fopen(fileName, "wb");
+    if (file == 0)
+    {
+        return false;
+    }
+
+    fprintf(file, "P6\n%i %i\n255\n", v_sizeH, v_sizeV);
+    for (uint32_t index = 0; index < v_frameSize; index += 1)
+    {
+        for (int8_t shift = 6; shift >= 0; shift -= 2)
+        {
+            fwrite(h_colourRGB[(frame[index] >> shift) & 0b11], 1, 3, file);
+        }
+    }
+    fclose(file);
+
+    return true;
+}
+
+int32_t hV_Virtual_Panel::comparePPM(const char * fileName, const uint8_t * frame)
+{
+    if (frame == 0)
+    {
+        frame = v_frame;
+    }
+
+    FILE * file = fopen(fileName, "rb");
+    if (file == 0)
+    {
+        return -1;
+    }
+
+    int32_t result = -1;
+    int width = 0;
+    int height = 0;
+    int depth = 0;
+    if ((fscanf(file, "P6 %i %i %i", &width, &height, &depth) == 3) and (fgetc(file) != EOF) and (width == v_sizeH) and (height == v_sizeV) and (depth == 255))
+    {
+        result = 0;
+        uint8_t rgb[3];
+        for (uint32_t index = 0; index < v_frameSize; index += 1)
+        {
+            for (int8_t shift = 6; shift >= 0; shift -= 2)
+            {
+                if (fread(rgb, 1, 3, file) != 3)
+                {
+                    fclose(file);
+                    return -1;
+                }
+                if (memcmp(rgb, h_colourRGB[(frame[index] >> shift) & 0b11], 3) != 0)
+                {
+                    result += 1;
+                }
+            }
+        }
+    }
+    fclose(file);
+
+    return result;
+}
+
+void hV_Virtual_Panel::setSnapshot(const char * prefix)
+{
+    v_snapshotPrefix = (prefix != 0) ? prefix : "";
+    v_snapshotIndex = 0;
+}
+
+void hV_Virtual_Panel::setReference(const char * prefix)
+{
+    v_referencePrefix = (prefix != 0) ? prefix : "";
+    v_referenceIndex = 0;
+    v_referenceFailures = 0;
+}
+
+uint32_t hV_Virtual_Panel::checkReference()
+{
+    if (v_referencePrefix.length() == 0)
+    {
+        return 0;
+    }
+
+    // Reference left without refresh
+    char fileName[256] = {0};
+    snprintf(fileName, sizeof(fileName), "%s_%03u.ppm", v_referencePrefix.c_str(), v_referenceIndex);
+    FILE * file = fopen(fileName, "rb");
+    if (file != 0)
+    {
+        fclose(file);
+        fprintf(stderr, "hV * Reference %s not refreshed\n", fileName);
+        v_referenceFailures += 1;
+    }
+
+    return v_referenceFailures;
+}
+
+bool hV_Virtual_Panel::isBusy()
+{
+    return (hV_HAL_Linux_getTime() < v_busyUntil);
+}
+
+void hV_Virtual_Panel::setBusy(uint32_t ms)
+{
+    v_setBusy(ms);
+}
+
+uint64_t hV_Virtual_Panel::getBusyUntil()
+{
+    return v_busyUntil;
+}
+
+void hV_Virtual_Panel::v_setBusy(uint32_t ms)
+{
+    v_busyUntil = hV_HAL_Linux_getTime() + (uint64_t)ms * 1000;
+}
+
+void hV_Virtual_Panel::pinChanged(uint8_t pin, uint8_t state)
+{
+    if ((pin == v_pinReset) and (state == HIGH))
+    {
+        countResets += 1;
+        v_flagPower = false;
+        v_flagPWR = false;
+        v_flagPSR = false;
+        v_flagRestore = false;
+        v_setBusy(2);
+    }
+}
+
+uint8_t hV_Virtual_Panel::transfer(uint8_t data)
+{
+    if (digitalRead(v_pinCS) == LOW) // Selected
+    {
+        countBytes += 1;
+        if (digitalRead(v_pinDC) == LOW) // Command
+        {
+            v_command(data);
+        }
+        else // Data
+        {
+            v_data(data);
+        }
+    }
+    return 0x00;
+}
+
+void hV_Virtual_Panel::v_command(uint8_t command)
+{
+    countCommands += 1;
+    v_command4 = command;
+    v_index4 = 0;
+
+    // Indicative durations
+    switch (command)
+    {
+        case 0x04: // Power on
+
+            v_flagPower = true;
+            v_setBusy(60);
+            break;
+
+        case 0x02: // Power off
+
+            v_flagPower = false;
+            v_setBusy(40);
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+void hV_Virtual_Panel::v_data(uint8_t data)
+{
+    switch (v_command4)
+    {
+        case 0x01: // PWR, as OTP table
+
+            if (v_index4 == 0)
+            {
+                if (v_flagRestore)
+                {
+                    fprintf(stderr, "hV * PSR not restored after refresh %i\n", countRefreshes);
+                    countErrors += 1;
+                    v_flagRestore = false;
+                }
+
+                v_flagPWR = (data == v_otp[16]);
+                if (not v_flagPWR)
+                {
+                    fprintf(stderr, "hV * PWR 0x%02x, expected 0x%02x\n", data, v_otp[16]);
+                    countErrors += 1;
+                }
+            }
+            break;
+
+        case 0x00: // PSR, as OTP table, restored after refresh on the 4.17"
+
+            if (v_index4 < 2)
+            {
+                v_psr[v_index4] = data;
+            }
+            if (v_index4 == 1)
+            {
+                uint8_t offset = v_flagRestore ? 26 : 17;
+                v_flagRestore = false;
+                v_flagPSR = (v_psr[0] == v_otp[offset]) and (v_psr[1] == v_otp[offset + 1]);
+                if (not v_flagPSR)
+                {
+                    fprintf(stderr, "hV * PSR 0x%02x 0x%02x, expected 0x%02x 0x%02x\n", v_psr[0], v_psr[1], v_otp[offset], v_otp[offset + 1]);
+                    countErrors += 1;
+                }
+            }
+            break;
+
+        case 0x61: // TRES, as OTP table
+
+            if ((v_index4 < 4) and (data != v_otp[19 + v_index4]))
+            {
+                fprintf(stderr, "hV * TRES byte %i 0x%02x, expected 0x%02x\n", v_index4, data, v_otp[19 + v_index4]);
+                countErrors += 1;
+            }
+            break;
+
+        case 0x10: // Frame
+
+            if (v_index4 < v_frameSize)
+            {
+                v_frame[v_index4] = data;
+            }
+            break;
+
+        case 0x12: // Refresh
+
+            countRefreshes += 1;
+            if (not (v_flagPWR and v_flagPSR))
+            {
+                fprintf(stderr, "hV * Refresh %i without PWR and PSR\n", countRefreshes);
+                countErrors += 1;
+            }
+            if (not v_flagPower)
+            {
+                fprintf(stderr, "hV * Refresh %i without power on\n", countRefreshes);
+                countErrors += 1;
+            }
+            v_flagRestore = (v_otp[43] == 0xff);
+            if (v_snapshotPrefix.length() > 0)
+            {
+                char fileName[256] = {0};
+                snprintf(fileName, sizeof(fileName), "%s_%03u.ppm", v_snapshotPrefix.c_str(), v_snapshotIndex);
+                v_snapshotIndex += 1;
+                if (not savePPM(fileName))
+                {
+                    fprintf(stderr, "hV * Snapshot %s failed\n", fileName);
+                }
+            }
+            if (v_referencePrefix.length() > 0)
+            {
+                char fileName[256] = {0};
+                snprintf(fileName, sizeof(fileName), "%s_%03u.ppm", v_referencePrefix.c_str(), v_referenceIndex);
+                v_referenceIndex += 1;
+                int32_t result = comparePPM(fileName);
+                if (result < 0)
+                {
+                    fprintf(stderr, "hV * Reference %s missing or different size\n", fileName);
+                    v_referenceFailures += 1;
+                }
+                else if (result > 0)
+                {
+                    fprintf(stderr, "hV * Reference %s: %i pixels different\n", fileName, result);
+                    v_referenceFailures += 1;
+                }
+            }
+            switch (v_sizeCode)
+            {
+                case 417:
+
+                    v_setBusy(26000);
+                    break;
+
+                case 266:
+
+                    v_setBusy(20000);
+                    break;
+
+                default:
+
+                    v_setBusy(16000);
+                    break;
+            }
+            break;
+
+        default:
+
+            break;
+    }
+    v_index4 += 1;
+}
+
+void hV_Virtual_Panel::write3(uint8_t data)
+{
+    hV_HAL_Linux_addTime(24000); // 8 bits x 3 us, as bit-bang
+
+    if (digitalRead(v_pinDC) == LOW) // Command
+    {
+        v_command3 = data;
+        v_index3 = 0;
+    }
+}
+
+uint8_t hV_Virtual_Panel::read3()
+{
+    uint8_t result = 0x00;
+    hV_HAL_Linux_addTime(16000); // 8 bits x 2 us, as bit-bang
+    countReadsOTP += 1;
+
+    switch (v_command3)
+    {
+        case 0x70: // Chip identifier
+
+            result = (v_index3 == 0) ? (v_chipId >> 8) : (v_chipId & 0xff);
+            break;
+
+        case 0xa1: // Read OTP, small screens
+        case 0x92: // Read OTP, 4.17"
+
+            if (v_index3 > 0) // First read is dummy
+            {
+                result = v_otp[(v_index3 - 1) % sizeof(v_otp)];
+            }
+            break;
+
+        default:
+
+            break;
+    }
+    v_index3 += 1;
+
+    return result;
+}
+//
+// === End of Virtual panel section
+//
+
+//
+// === Main section
+//
+extern void setup();
+extern void loop();
+
+///
+/// @brief Main function
+/// @details Configure the virtual panel, call setup() and loop()
+/// @return 0 if successful, 1 if a frame differs from its reference or a sequence is wrong
+///
+int main()
+{
+    // Default pins, replaced by the board of the screen in hV_Board::b_begin()
+    pins_t board = boardRaspberryPiPico_RP2040;
+    myVirtualPanel.begin(hV_HAL_LINUX_PANEL, board.panelBusy, board.panelDC, board.panelReset, board.panelCS);
+    myVirtualPanel.setSnapshot(getenv("hV_HAL_LINUX_SNAPSHOT"));
+    myVirtualPanel.setReference(getenv("hV_HAL_LINUX_REFERENCE"));
+
+    const char * clock = getenv("hV_HAL_LINUX_CLOCK");
+    hV_HAL_Linux_setClock(not ((clock != 0) and (strcmp(clock, "virtual") == 0)));
+
+    setup();
+    for (uint32_t index = 0; index < hV_HAL_LINUX_LOOPS; index += 1)
+    {
+        loop();
+    }
+    fflush(stdout);
+
+    // Golden images, failure if any frame differs from its reference or any sequence is wrong
+    uint32_t failures = myVirtualPanel.checkReference() + myVirtualPanel.countErrors;
+    return (failures > 0) ? 1 : 0;
+}
+//
+// === End of Main section
+//
+
+#endif // hV_HAL_LINUX
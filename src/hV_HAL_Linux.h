@@ -0,0 +1,458 @@
+///
+/// @file hV_HAL_Linux.h
+/// @brief Light hardware abstraction layer for Linux host with virtual panel
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The Linux host backend provides the subset of the Arduino SDK used by the library
+/// and an emulated Spectra 4 COG, so begin() and flush() run unmodified on a workstation
+/// for benchmarking and continuous integration.
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// The Arduino IDE compiles all the files, hence this condition.
+#if defined(hV_HAL_LINUX)
+
+#ifndef hV_HAL_LINUX_RELEASE
+///
+/// @brief Release
+///
+#define hV_HAL_LINUX_RELEASE 830
+
+///
+/// @brief Standard libraries
+///
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <string>
+
+///
+/// @name Arduino SDK subset
+/// @{
+
+typedef bool boolean; ///< Arduino boolean
+typedef uint8_t byte; ///< Arduino byte
+
+#define PI 3.1415926535897932384626433832795 ///< Arduino constant
+
+#define HIGH 0x1 ///< High level
+#define LOW 0x0 ///< Low level
+
+#define INPUT 0x0 ///< Input pin
+#define OUTPUT 0x1 ///< Output pin
+#define INPUT_PULLUP 0x2 ///< Input pin with pull-up
+
+#define CHANGE 0x1 ///< Interrupt on change
+#define FALLING 0x2 ///< Interrupt on falling edge
+#define RISING 0x3 ///< Interrupt on rising edge
+
+#define NOT_AN_INTERRUPT -1 ///< No interrupt for pin
+#define digitalPinToInterrupt(pin) (pin) ///< Interrupt number for pin
+
+#define LSBFIRST 0 ///< SPI bit order
+#define MSBFIRST 1 ///< SPI bit order
+#define SPI_MODE0 0x00 ///< SPI data mode
+
+#define SCK 18 ///< Virtual 3-wire SPI clock, as Raspberry Pi Pico
+#define MOSI 19 ///< Virtual 3-wire SPI data, as Raspberry Pi Pico
+#define LED_BUILTIN 25 ///< Virtual LED, as Raspberry Pi Pico
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01) ///< Read bit
+#define bitSet(value, bit) ((value) |= (1UL << (bit))) ///< Set bit
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit))) ///< Clear bit
+
+///
+/// @brief Minimum of two numbers
+///
+template <typename T1, typename T2>
+inline T1 min(T1 a, T2 b)
+{
+    return (a < (T1)b) ? a : (T1)b;
+}
+
+///
+/// @brief Maximum of two numbers
+///
+template <typename T1, typename T2>
+inline T1 max(T1 a, T2 b)
+{
+    return (a > (T1)b) ? a : (T1)b;
+}
+
+///
+/// @brief Re-map a number from one range to another
+///
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh);
+
+///
+/// @brief String class
+/// @details Subset of the Arduino String object
+///
+class String
+{
+  public:
+    String(const char * text = "");
+    String(const std::string & text);
+    String(char character);
+    String(int value, uint8_t base = 10);
+    String(unsigned int value, uint8_t base = 10);
+    String(long value, uint8_t base = 10);
+    String(unsigned long value, uint8_t base = 10);
+
+    unsigned int length() const;
+    char charAt(unsigned int index) const;
+    const char * c_str() const;
+    String substring(unsigned int start) const;
+    String substring(unsigned int start, unsigned int end) const;
+    int indexOf(char character) const;
+    void toCharArray(char * buffer, unsigned int size) const;
+
+    String & operator+=(const String & other);
+    friend String operator+(const String & a, const String & b);
+    bool operator==(const String & other) const;
+    bool operator!=(const String & other) const;
+    char operator[](unsigned int index) const;
+
+  private:
+    std::string _text;
+};
+
+///
+/// @brief Serial console
+/// @details Output to stdout
+///
+class HardwareSerial
+{
+  public:
+    void begin(uint32_t speed);
+    void flush();
+    size_t print(const String & text);
+    size_t print(const char * text);
+    size_t print(char character);
+    size_t print(int32_t value);
+    size_t println(const String & text);
+    size_t println(const char * text);
+    size_t println(char character);
+    size_t println(int32_t value);
+    size_t println();
+};
+
+///
+/// @brief Serial console instance
+///
+extern HardwareSerial Serial;
+
+///
+/// @brief Configure pin
+/// @param pin pin number
+/// @param mode INPUT, OUTPUT or INPUT_PULLUP
+///
+void pinMode(uint8_t pin, uint8_t mode);
+
+///
+/// @brief Write pin
+/// @param pin pin number
+/// @param state HIGH or LOW
+///
+void digitalWrite(uint8_t pin, uint8_t state);
+
+///
+/// @brief Read pin
+/// @param pin pin number
+/// @return HIGH or LOW
+/// @note The panelBusy pin reflects the state of the virtual panel
+///
+int digitalRead(uint8_t pin);
+
+///
+/// @brief Attach interrupt
+/// @param interrupt interrupt number, see digitalPinToInterrupt()
+/// @param isr interrupt service routine
+/// @param mode CHANGE, FALLING or RISING
+/// @note Only on panelBusy, one interrupt at a time
+/// @note Called by hV_HAL_Linux_sleep() when the virtual panel is ready
+///
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+
+///
+/// @brief Detach interrupt
+/// @param interrupt interrupt number, see digitalPinToInterrupt()
+///
+void detachInterrupt(uint8_t interrupt);
+
+///
+/// @brief Wait
+/// @param ms duration, ms
+/// @note Virtual time, no actual sleep
+///
+void delay(uint32_t ms);
+
+///
+/// @brief Wait
+/// @param us duration, us
+/// @note Virtual time, no actual sleep
+///
+void delayMicroseconds(uint32_t us);
+
+///
+/// @brief Elapsed time, ms
+/// @return elapsed time, ms
+/// @note Actual time plus virtual time
+///
+uint32_t millis();
+
+///
+/// @brief Elapsed time, us
+/// @return elapsed time, us
+/// @note Actual time plus virtual time
+///
+uint32_t micros();
+
+///
+/// @brief Yield to scheduler
+///
+void yield();
+
+/// @}
+
+///
+/// @brief Emulated Spectra 4 COG
+/// @details Decode the command stream sent over 4-wire SPI and answer 3-wire SPI OTP reads
+/// * 0x00 PSR, 0x01 PWR, 0x61 TRES: checked against the OTP table, PSR restored after refresh and before next PWR on the 4.17"
+/// * 0x04 power on, 0x12 refresh, 0x02 power off: busy for the indicative duration
+/// * 0x12 refresh: error without PWR, PSR and power on since reset
+/// * 0x10: frame data recorded
+/// * 0x70, 0xa1, 0xa0 and 0x92: chip identifier and OTP table
+///
+class hV_Virtual_Panel
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Virtual_Panel();
+
+    ///
+    /// @brief Configure the virtual panel
+    /// @param sizeCode screen size, 154, 213, 266 or 417
+    /// @param pinBusy panelBusy pin
+    /// @param pinDC panelDC pin
+    /// @param pinReset panelReset pin
+    /// @param pinCS panelCS pin
+    ///
+    void begin(uint16_t sizeCode, uint8_t pinBusy, uint8_t pinDC, uint8_t pinReset, uint8_t pinCS);
+
+    ///
+    /// @brief Connect the virtual panel to the pins of the board
+    /// @param pinBusy panelBusy pin
+    /// @param pinDC panelDC pin
+    /// @param pinReset panelReset pin
+    /// @param pinCS panelCS pin
+    /// @note Called by hV_Board::b_begin() with the board of the screen
+    ///
+    void setPins(uint8_t pinBusy, uint8_t pinDC, uint8_t pinReset, uint8_t pinCS);
+
+    ///
+    /// @brief Frame-buffer received with command 0x10
+    /// @return pointer to the frame-buffer
+    ///
+    const uint8_t * getFrame();
+
+    ///
+    /// @brief Size of the frame-buffer
+    /// @return number of bytes, 2 bits per pixel
+    ///
+    uint32_t getFrameSize();
+
+    ///
+    /// @brief Panel sizes
+    /// @param[out] sizeV vertical = wide size, number of rows
+    /// @param[out] sizeH horizontal = small size, number of pixels per row
+    ///
+    void getSize(uint16_t & sizeV, uint16_t & sizeH);
+
+    ///
+    /// @brief Save the frame-buffer as image
+    /// @param fileName name of the PPM file
+    /// @param frame frame-buffer, default = last frame received with command 0x10
+    /// @return true if successful, false otherwise
+    /// @note Portable pixmap P6, one pixel per physical pixel, rows = vertical size
+    /// @note 2-bit codes 0b00 black, 0b01 white, 0b10 yellow, 0b11 red
+    ///
+    bool savePPM(const char * fileName, const uint8_t * frame = 0);
+
+    ///
+    /// @brief Compare the frame-buffer with an image
+    /// @param fileName name of the reference PPM file
+    /// @param frame frame-buffer, default = last frame received with command 0x10
+    /// @return number of different pixels, or -1 if reference not readable or different size
+    ///
+    int32_t comparePPM(const char * fileName, const uint8_t * frame = 0);
+
+    ///
+    /// @brief Save each frame on refresh
+    /// @param prefix path and prefix for the PPM files, nullptr or empty to disable
+    /// @note Files prefix_000.ppm, prefix_001.ppm, ...
+    /// @note Set at start-up by environment variable hV_HAL_LINUX_SNAPSHOT
+    ///
+    void setSnapshot(const char * prefix);
+
+    ///
+    /// @brief Compare each frame on refresh with reference images
+    /// @param prefix path and prefix for the reference PPM files, nullptr or empty to disable
+    /// @note Files prefix_000.ppm, prefix_001.ppm, ... compared with comparePPM()
+    /// @note Set at start-up by environment variable hV_HAL_LINUX_REFERENCE
+    ///
+    void setReference(const char * prefix);
+
+    ///
+    /// @brief Check the frames against the reference images
+    /// @return number of frames different or without reference, plus one if references are left
+    /// @note Called by main() after loop(), non-zero exit code if failures
+    ///
+    uint32_t checkReference();
+
+    ///
+    /// @brief Set the virtual panel busy
+    /// @param ms duration, ms
+    /// @note For testing the busy wait strategies
+    ///
+    void setBusy(uint32_t ms);
+
+    ///
+    /// @brief End of the busy period
+    /// @return virtual time, us
+    ///
+    uint64_t getBusyUntil();
+
+    /// @name Counters
+    /// @{
+    uint32_t countCommands; ///< commands received
+    uint32_t countBytes; ///< bytes received over 4-wire SPI
+    uint32_t countRefreshes; ///< display refreshes
+    uint32_t countResets; ///< hardware resets
+    uint32_t countReadsOTP; ///< bytes read over 3-wire SPI
+    uint32_t countErrors; ///< sequences different from the OTP table or the application note
+    /// @}
+
+    /// @cond
+    bool isBusy();
+    void pinChanged(uint8_t pin, uint8_t state);
+    uint8_t transfer(uint8_t data);
+    void write3(uint8_t data);
+    uint8_t read3();
+
+    uint8_t v_pinBusy, v_pinDC, v_pinReset, v_pinCS;
+
+  private:
+    void v_command(uint8_t command);
+    void v_data(uint8_t data);
+    void v_setBusy(uint32_t ms);
+
+    uint16_t v_sizeCode, v_sizeV, v_sizeH;
+    uint16_t v_chipId;
+    uint8_t v_otp[112];
+    uint8_t v_command3;
+    uint16_t v_index3;
+    uint8_t v_command4;
+    uint32_t v_index4;
+    uint8_t * v_frame;
+    uint32_t v_frameSize;
+    std::string v_snapshotPrefix;
+    uint32_t v_snapshotIndex;
+    std::string v_referencePrefix;
+    uint32_t v_referenceIndex;
+    uint32_t v_referenceFailures;
+    uint64_t v_busyUntil;
+    bool v_flagPower;
+    bool v_flagPWR, v_flagPSR; // set since reset and as OTP table
+    bool v_flagRestore; // PSR to be restored after refresh
+    uint8_t v_psr[2];
+    /// @endcond
+};
+
+///
+/// @brief Virtual panel instance
+///
+extern hV_Virtual_Panel myVirtualPanel;
+
+///
+/// @brief Virtual time, us
+/// @return elapsed time, us
+/// @note Actual time plus virtual time, 64-bit
+/// @n Virtual time only, plus 1 us per call, with environment variable hV_HAL_LINUX_CLOCK=virtual,
+/// for reproducible measures on golden images
+///
+uint64_t hV_HAL_Linux_getTime();
+
+///
+/// @brief Set the clock
+/// @param actual true = actual plus virtual time, false = virtual time only
+/// @note Set at start-up by environment variable hV_HAL_LINUX_CLOCK
+///
+void hV_HAL_Linux_setClock(bool actual);
+
+///
+/// @brief Add virtual time
+/// @param ns duration to add, ns
+///
+void hV_HAL_Linux_addTime(uint64_t ns);
+
+///
+/// @brief Sleep until next interrupt
+/// @details Jump to the end of the busy period of the virtual panel and call the attached interrupt,
+/// otherwise to the next 1 ms tick
+/// @note Wake-up latency of hV_HAL_LINUX_WAKE_US
+///
+void hV_HAL_Linux_sleep();
+
+///
+/// @name Default configuration
+/// @note Set with -D at compilation
+/// @{
+#ifndef hV_HAL_LINUX_PANEL
+#define hV_HAL_LINUX_PANEL 266 ///< 154, 213, 266 or 417
+#endif // hV_HAL_LINUX_PANEL
+
+#ifndef hV_HAL_LINUX_WAKE_US
+#define hV_HAL_LINUX_WAKE_US 5 ///< wake-up latency after interrupt, us
+#endif // hV_HAL_LINUX_WAKE_US
+
+#ifndef hV_HAL_LINUX_LOOPS
+#define hV_HAL_LINUX_LOOPS 1 ///< number of calls to loop()
+#endif // hV_HAL_LINUX_LOOPS
+/// @}
+
+#endif // hV_HAL_LINUX_RELEASE
+
+#endif // hV_HAL_LINUX
@@ -25,6 +25,10 @@
 // Release 804: Improved power management
 // Release 805: Improved stability
 // Release 810: Added patches for some platforms
+// Release 830: Added Linux host with virtual panel
+// Release 830: Added SPI block transfer
+// Release 830: Added busy wait strategies
+// Release 830: Added polling for pin without interrupt
 //
 
 // Library header
@@ -33,7 +37,22 @@
 //
 // === General section
 //
-#if defined(ENERGIA)
+#if defined(hV_HAL_LINUX)
+///
+/// @brief SPI settings for screen
+/// @note Only the clock is used, for the virtual time
+///
+struct _SPISettings_s
+{
+    uint32_t clock; ///< in Hz
+    uint8_t bitOrder; ///< LSBFIRST, MSBFIRST
+    uint8_t dataMode; ///< SPI_MODE0
+};
+///
+/// @brief SPI settings for screen
+///
+_SPISettings_s _settingScreen = {8000000, MSBFIRST, SPI_MODE0};
+#elif defined(ENERGIA)
 ///
 /// @brief Proxy for SPISettings
 /// @details Not implemented in Energia
@@ -79,12 +98,99 @@ void hV_HAL_begin()
 //
 // === GPIO section
 //
-void waitFor(uint8_t pin, uint8_t state)
+///
+/// @brief Flag set by interrupt on pin change
+///
+static volatile bool h_flagWaitFor = false;
+
+///
+/// @brief Sleep function, nullptr for default
+///
+static void (*h_sleep)() = 0; // nullptr
+
+///
+/// @brief Interrupt service routine for waitFor()
+///
+static void h_interruptWaitFor()
+{
+    h_flagWaitFor = true;
+}
+
+void hV_HAL_setSleep(void (*sleep)())
+{
+    h_sleep = sleep;
+}
+
+void hV_HAL_sleep()
+{
+    if (h_sleep != 0)
+    {
+        h_sleep();
+    }
+    else
+    {
+#if defined(hV_HAL_LINUX)
+        hV_HAL_Linux_sleep();
+#elif defined(__arm__)
+        __asm__ volatile("wfi"); // woken up by any interrupt, including tick
+#else
+        delay(1);
+#endif // hV_HAL_LINUX
+    }
+}
+
+uint32_t waitFor(uint8_t pin, uint8_t state, uint8_t strategy)
 {
-    while (digitalRead(pin) != state)
+    uint32_t count = 0;
+
+    switch (strategy)
     {
-        delay(32); // non-blocking
+        case BUSY_WAIT_INTERRUPT:
+
+#if defined(NOT_AN_INTERRUPT)
+            // Pin without interrupt, polling instead
+            if (digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT)
+            {
+                count = waitFor(pin, state, BUSY_WAIT_POLL);
+                break;
+            }
+#endif // NOT_AN_INTERRUPT
+
+            h_flagWaitFor = false;
+            attachInterrupt(digitalPinToInterrupt(pin), h_interruptWaitFor, (state == HIGH) ? RISING : FALLING);
+            while (digitalRead(pin) != state)
+            {
+                count += 1;
+                // Interrupt between test and sleep, woken up by next interrupt
+                if (not h_flagWaitFor)
+                {
+                    hV_HAL_sleep();
+                }
+                h_flagWaitFor = false;
+            }
+            detachInterrupt(digitalPinToInterrupt(pin));
+            break;
+
+        case BUSY_WAIT_YIELD:
+
+            while (digitalRead(pin) != state)
+            {
+                count += 1;
+                yield();
+            }
+            break;
+
+        default: // BUSY_WAIT_POLL
+
+            while (digitalRead(pin) != state)
+            {
+                count += 1;
+                delay(32); // non-blocking
+            }
+            break;
     }
+
+    return count;
 }
 //
 // === End of GPIO section
@@ -109,7 +215,11 @@ void hV_HAL_SPI_begin(uint32_t speed)
     {
         _settingScreen = {speed, MSBFIRST, SPI_MODE0};
 
-#if defined(ENERGIA)
+#if defined(hV_HAL_LINUX)
+
+        // Virtual panel
+
+#elif defined(ENERGIA)
 
         SPI.begin();
         SPI.setBitOrder(_settingScreen.bitOrder);
@@ -146,14 +256,66 @@ void hV_HAL_SPI_end()
 {
     if (flagSPI != false)
     {
+#if !defined(hV_HAL_LINUX)
         SPI.end();
+#endif // hV_HAL_LINUX
         flagSPI = false;
     }
 }
 
 uint8_t hV_HAL_SPI_transfer(uint8_t data)
 {
+#if defined(hV_HAL_LINUX)
+
+    hV_HAL_Linux_addTime(8000000000ULL / _settingScreen.clock); // 8 bits
+    return myVirtualPanel.transfer(data);
+
+#else
+
     return SPI.transfer(data);
+
+#endif // hV_HAL_LINUX
+}
+
+void hV_HAL_SPI_transferBlock(const uint8_t * data, size_t size)
+{
+#if defined(hV_HAL_LINUX)
+
+    hV_HAL_Linux_addTime(8000000000ULL * size / _settingScreen.clock); // 8 bits per byte
+    for (size_t i = 0; i < size; i++)
+    {
+        myVirtualPanel.transfer(data[i]);
+    }
+
+#elif defined(ENERGIA)
+
+    for (size_t i = 0; i < size; i++)
+    {
+        SPI.transfer(data[i]);
+    }
+
+#elif defined(ARDUINO_ARCH_ESP32)
+
+    SPI.writeBytes(data, size);
+
+#elif defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+
+    SPI.transfer(data, nullptr, size); // Arduino-Pico core, write only
+
+#else // General case
+
+    // In-place transfer overwrites the buffer, hence the copy
+    uint8_t buffer[64];
+    while (size > 0)
+    {
+        size_t chunk = min(size, sizeof(buffer));
+        memcpy(buffer, data, chunk);
+        SPI.transfer(buffer, chunk);
+        data += chunk;
+        size -= chunk;
+    }
+
+#endif // hV_HAL_LINUX
 }
 
 //
@@ -163,6 +325,29 @@ uint8_t hV_HAL_SPI_transfer(uint8_t data)
 //
 // === Wire section
 //
+#if defined(hV_HAL_LINUX)
+
+void hV_HAL_Wire_begin()
+{
+    ;
+}
+
+void hV_HAL_Wire_end()
+{
+    ;
+}
+
+void hV_HAL_Wire_transfer(uint8_t, uint8_t *, size_t, uint8_t * dataRead, size_t sizeRead)
+{
+    // No I2C device on the virtual panel
+    if (sizeRead > 0)
+    {
+        memset(dataRead, 0x00, sizeRead);
+    }
+}
+
+#else
+
 bool flagWire = false; // Some Wire implementations require unique initialisation
 
 void hV_HAL_Wire_begin()
@@ -233,6 +418,8 @@ void hV_HAL_Wire_transfer(uint8_t address, uint8_t * dataWrite, size_t sizeWrite
         }
     }
 }
+
+#endif // hV_HAL_LINUX
 //
 // === End of Wire section
 //
@@ -268,6 +455,12 @@ void hV_HAL_SPI3_define(uint8_t pinClock, uint8_t pinData)
 
 uint8_t hV_HAL_SPI3_read()
 {
+#if defined(hV_HAL_LINUX)
+
+    return myVirtualPanel.read3();
+
+#else
+
     uint8_t value = 0;
 
     pinMode(h_pinSPI3.pinClock, OUTPUT);
@@ -283,10 +476,18 @@ uint8_t hV_HAL_SPI3_read()
     }
 
     return value;
+
+#endif // hV_HAL_LINUX
 }
 
 void hV_HAL_SPI3_write(uint8_t value)
 {
+#if defined(hV_HAL_LINUX)
+
+    myVirtualPanel.write3(value);
+
+#else
+
     pinMode(h_pinSPI3.pinClock, OUTPUT);
     pinMode(h_pinSPI3.pinData, OUTPUT);
 
@@ -299,6 +500,8 @@ void hV_HAL_SPI3_write(uint8_t value)
         digitalWrite(h_pinSPI3.pinClock, LOW);
         delayMicroseconds(1);
     }
+
+#endif // hV_HAL_LINUX
 }
 //
 // === End of 3-wire SPI section
@@ -6,8 +6,8 @@
 /// @n Based on highView technology
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -36,7 +36,17 @@
 ///
 /// @brief Release
 ///
-#define hV_HAL_PERIPHERALS_RELEASE 812
+#define hV_HAL_PERIPHERALS_RELEASE 830
+
+#if defined(hV_HAL_LINUX)
+
+///
+/// @brief Linux host with virtual panel
+/// @note Set with -DhV_HAL_LINUX
+///
+#include "hV_HAL_Linux.h"
+
+#else
 
 ///
 /// @brief SDK library
@@ -52,6 +62,8 @@
 #include <SPI.h>
 #include <Wire.h>
 
+#endif // hV_HAL_LINUX
+
 ///
 /// @brief Other libraries
 ///
@@ -59,6 +71,11 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+///
+/// @brief Constants
+///
+#include "hV_List_Constants.h"
+
 #define mySerial Serial
 
 ///
@@ -70,8 +87,31 @@ void hV_HAL_begin();
 /// @brief Wait for
 /// @param pin pin number
 /// @param state state to reach, default = HIGH
+/// @param strategy busy wait strategy, default = BUSY_WAIT_POLL, otherwise BUSY_WAIT_INTERRUPT or BUSY_WAIT_YIELD
+/// @return number of reads of pin before reaching state
+/// @note
+/// * BUSY_WAIT_POLL reads pin every 32 ms, up to 32 ms latency
+/// * BUSY_WAIT_INTERRUPT attaches an interrupt to pin and sleeps until the change, BUSY_WAIT_POLL if pin has no interrupt
+/// * BUSY_WAIT_YIELD reads pin continuously and yields to the scheduler
+///
+uint32_t waitFor(uint8_t pin, uint8_t state = HIGH, uint8_t strategy = BUSY_WAIT_POLL);
+
+///
+/// @brief Sleep until next interrupt
+/// @details Used by waitFor() with BUSY_WAIT_INTERRUPT
+/// @note Default is WFI on ARM, 1 ms otherwise
+/// @warning The interrupt of waitFor() may occur between the test of the flag and the sleep.
+/// The wake-up then relies on the next interrupt, such as the SysTick tick,
+/// so a sleep function without any periodic interrupt may wait for ever.
+///
+void hV_HAL_sleep();
+
+///
+/// @brief Set the sleep function
+/// @param sleep function called by hV_HAL_sleep(), nullptr for default
+/// @note Use for a platform-specific low-power mode or a scheduler semaphore
 ///
-void waitFor(uint8_t pin, uint8_t state = HIGH);
+void hV_HAL_setSleep(void (*sleep)());
 
 ///
 /// @brief Configure and start SPI
@@ -97,11 +137,25 @@ void hV_HAL_SPI_end();
 ///
 uint8_t hV_HAL_SPI_transfer(uint8_t data);
 
+///
+/// @brief Write a block of bytes
+/// @param data pointer to the bytes
+/// @param size number of bytes
+/// @note Block transfer of the core when available, read bytes discarded
+/// * ESP32: SPI.writeBytes()
+/// * RP2040 with Arduino-Pico core: SPI.transfer(data, nullptr, size)
+/// * Other cores: chunks of 64 bytes with in-place SPI.transfer(buffer, size)
+/// * Energia: byte per byte
+/// @warning No check for previous initialisation
+///
+void hV_HAL_SPI_transferBlock(const uint8_t * data, size_t size);
+
 ///
 /// @name 3-wire SPI bus
 /// @warning
 /// * Arduino does not support 3-wire SPI, bit-bang simulation
 /// * Viewer: For compatibility only, not implemented in Linux
+/// * Linux host: emulated by the virtual panel
 /// @note hV_HAL_SPI3_begin() sets the pins for 3-wire SPI.
 /// @{
 
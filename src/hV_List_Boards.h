@@ -12,8 +12,8 @@
 ///     * 2.3 Deprecated boards
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -44,11 +44,14 @@
 // Options
 #include "hV_List_Options.h"
 
+// Constants
+#include "hV_List_Constants.h"
+
 #ifndef hV_LIST_BOARDS_RELEASE
 ///
 /// @brief Release
 ///
-#define hV_LIST_BOARDS_RELEASE 812
+#define hV_LIST_BOARDS_RELEASE 830
 
 ///
 /// @brief Not connected pin
@@ -84,6 +87,7 @@ struct pins_t
     uint8_t panelPower; ///< Optional power circuit
     uint8_t cardCS; ///< Separate SD-card board
     uint8_t cardDetect; ///< Separate SD-card board
+    uint8_t panelBusyWait; ///< Busy wait strategy, default = BUSY_WAIT_POLL
 };
 
 ///
@@ -109,6 +113,7 @@ const pins_t boardArduinoNanoMatter =
     .panelPower = 2, ///< Optional power circuit -> D2
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -131,6 +136,7 @@ const pins_t boardRaspberryPiPico_RP2040 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -151,6 +157,7 @@ const pins_t boardFeatherNRF52840 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -173,6 +180,7 @@ const pins_t boardESP32DevKitC =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 /// @}
@@ -201,6 +209,7 @@ const pins_t boardRaspberryPiPico_Arduino =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -220,6 +229,7 @@ const pins_t boardFeatherM0M4 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -239,6 +249,7 @@ const pins_t boardFeatherNRF52832 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -265,6 +276,7 @@ const pins_t boardArduinoZero =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -290,6 +302,7 @@ const pins_t boardParticlePhoton =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -311,6 +324,7 @@ const pins_t boardESP32PicoKitV4 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -332,6 +346,7 @@ const pins_t boardESP32PicoDevKitM2 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -352,6 +367,7 @@ const pins_t boardXiaoRP2040
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -374,6 +390,7 @@ const pins_t boardSiLabsBG24Explorer =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -394,6 +411,7 @@ const pins_t boardNucleo32L431KC =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -413,6 +431,7 @@ const pins_t boardTeensy3x =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 /// @}
@@ -439,6 +458,7 @@ const pins_t boardLaunchPad =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit -> 2
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board -> 5
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -458,7 +478,8 @@ const pins_t boardMSP430FR5994 =
     .touchReset = NOT_CONNECTED, ///< EXT3-Touch pin 4 Orange
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = 47, ///< Included SD-card
-    .cardDetect = 51 ///< Included SD-card
+    .cardDetect = 51, ///< Included SD-card
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -479,6 +500,7 @@ const pins_t boardCC1352 =
     .panelPower = NOT_CONNECTED, ///< Optional power circuit
     .cardCS = NOT_CONNECTED, ///< Separate SD-card board
     .cardDetect = NOT_CONNECTED, ///< Separate SD-card board
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 /// @}
@@ -536,6 +558,8 @@ struct pins_t
     uint8_t imuInt2; ///< EXT4 pin 19 Brown LIS2DH12 !INT1, I2C address = 0x19
     uint8_t weatherInt; ///< EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40
     // End of EXT4 specific
+
+    uint8_t panelBusyWait; ///< Busy wait strategy, default = BUSY_WAIT_POLL
 };
 
 ///
@@ -575,6 +599,7 @@ const pins_t boardArduinoNanoMatter =
     .imuInt2 = 15, // EXT4 pin 19 Brown LIS2DH12 !INT2, I2C address = 0x19 -> A1
     .weatherInt = 14, // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40 -> A0
     // End of EXT4 specific
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -607,8 +632,9 @@ const pins_t boardSiLabsBG24Explorer =
     .nfcFD = NOT_CONNECTED, // EXT4 pin 17 Orange NFC NT3H2111_2211 !Field detect, I2C address = 0x55
     .imuInt1 = NOT_CONNECTED, // EXT4 pin 18 Red LIS2DH12 !INT1, I2C address = 0x19
     .imuInt2 = NOT_CONNECTED, // EXT4 pin 19 Brown LIS2DH12 !INT2, I2C address = 0x19
-    .weatherInt = NOT_CONNECTED // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40
+    .weatherInt = NOT_CONNECTED, // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40
     // End of EXT4 specific
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 ///
@@ -643,8 +669,9 @@ const pins_t boardRaspberryPiPico_RP2040 =
     .nfcFD = 7, // EXT4 pin 17 Orange NFC NT3H2111_2211 !Field detect, I2C address = 0x55 -> GP7
     .imuInt1 = 8, // EXT4 pin 18 Red LIS2DH12 !INT2, I2C address = 0x19 -> GP8
     .imuInt2 = 9, // EXT4 pin 19 Brown LIS2DH12 !INT1, I2C address = 0x19 -> GP9
-    .weatherInt = 3 // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40 -> GP3
+    .weatherInt = 3, // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40 -> GP3
     // End of EXT4 specific
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 /// @}
@@ -682,8 +709,9 @@ const pins_t boardSiLabsBGM220Explorer =
     .nfcFD = NOT_CONNECTED, // EXT4 pin 17 Orange NFC NT3H2111_2211 !Field detect, I2C address = 0x55
     .imuInt1 = NOT_CONNECTED, // EXT4 pin 18 Red LIS2DH12 !INT1, I2C address = 0x19
     .imuInt2 = NOT_CONNECTED, // EXT4 pin 19 Brown LIS2DH12 !INT2, I2C address = 0x19
-    .weatherInt = NOT_CONNECTED // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40
+    .weatherInt = NOT_CONNECTED, // EXT4 pin 20 Black HDC2080 !INT, I2C address = 0x40
     // End of EXT4 specific
+    .panelBusyWait = BUSY_WAIT_POLL, ///< Busy wait strategy
 };
 
 /// @}
@@ -6,8 +6,8 @@
 /// @n Based on highView technology
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -39,7 +39,7 @@
 ///
 /// @brief Release
 ///
-#define hV_LIST_CONSTANTS_RELEASE 812
+#define hV_LIST_CONSTANTS_RELEASE 830
 
 ///
 /// * General parameters
@@ -116,6 +116,29 @@
 #define FSM_BUS_MASK 0x10 ///< Mask for bus on
 /// @}
 
+///
+/// @name Asynchronous update state
+/// @note Numbers are sequential and exclusive
+/// @{
+#define FLUSH_IDLE 0x00 ///< No update in progress
+#define FLUSH_INITIAL 0x01 ///< Resume and initialise
+#define FLUSH_SEND 0x02 ///< Send image and power on
+#define FLUSH_REFRESH 0x03 ///< Refresh
+#define FLUSH_OFF 0x04 ///< Power off
+#define FLUSH_PAUSE 0x05 ///< Wait after power off
+#define FLUSH_RESTORE 0x06 ///< Restore settings
+#define FLUSH_END 0x07 ///< Suspend and call back
+/// @}
+
+///
+/// @name Busy wait strategy
+/// @note Numbers are sequential and exclusive
+/// @{
+#define BUSY_WAIT_POLL 0x00 ///< Poll every 32 ms, default
+#define BUSY_WAIT_INTERRUPT 0x01 ///< Interrupt on panelBusy and sleep
+#define BUSY_WAIT_YIELD 0x02 ///< Poll and yield to scheduler
+/// @}
+
 ///
 /// @name Partial update state
 /// @deprecated Use fast update instead (6.1.0).
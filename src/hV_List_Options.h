@@ -15,12 +15,12 @@
 /// * 9. Set GPIO expander mode, not implemented
 /// * 10. String object for basic edition
 /// * 11. Set storage mode, not implemented
-/// * 12. Set debug options, not implemented
+/// * 12. Set debug options
 /// * 13. Select EXT board
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -49,7 +49,7 @@
 ///
 /// @brief Release
 ///
-#define hV_LIST_OPTIONS_RELEASE 812
+#define hV_LIST_OPTIONS_RELEASE 830
 
 ///
 /// @name 1- List of supported Pervasive Displays screens
@@ -196,11 +196,19 @@
 
 ///
 /// @name 12- Debug options
-/// * Basic edition: none
+/// * Basic edition: none or statistics
 /// * Evaluation edition: all
 /// * Commercial edition: option
 /// * Viewer edition: option
 ///
+/// @{
+#define USE_DEBUG_NONE 0 ///< No debug
+#define USE_DEBUG_STATS 1 ///< Statistics and trace for update
+
+#ifndef DEBUG_MODE
+#define DEBUG_MODE USE_DEBUG_NONE ///< Selected option
+#endif // DEBUG_MODE
+/// @}
 
 ///
 /// @name 13- EXT boards
@@ -21,6 +21,13 @@
 // Release 703: Improved orientation function
 // Release 801: Improved functions names consistency
 // Release 805: Added large variant for gText()
+// Release 830: Added span fill for lines and solid rectangles
+// Release 830: Added glyph columns for gText()
+// Release 830: Added character hook for glyph cache
+// Release 830: Added scaled text
+// Release 830: Added scanline rasteriser for triangle()
+// Release 830: Added span fill for circle(), added ellipse() and roundRectangle()
+// Release 830: Added getters for pen and font solid, virtual as the setters
 //
 
 // Library header
@@ -148,6 +155,18 @@ uint8_t hV_Screen_Buffer::screenColourBits()
 }
 
 void hV_Screen_Buffer::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
+{
+    if (v_penSolid == false)
+    {
+        s_roundOutline(x0, y0, x0, y0, radius, colour);
+    }
+    else
+    {
+        s_roundArea(x0, y0, x0, y0, radius, colour);
+    }
+}
+
+void hV_Screen_Buffer::s_roundOutline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour)
 {
     int16_t f = 1 - radius;
     int16_t ddF_x = 1;
@@ -155,59 +174,202 @@ void hV_Screen_Buffer::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_
     int16_t x = 0;
     int16_t y = radius;
 
-    if (v_penSolid == false)
+    point(x1, y2 + radius, colour);
+    point(x1, y1 - radius, colour);
+    point(x2 + radius, y1, colour);
+    point(x1 - radius, y1, colour);
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        point(x2 + x, y2 + y, colour);
+        point(x1 - x, y2 + y, colour);
+        point(x2 + x, y1 - y, colour);
+        point(x1 - x, y1 - y, colour);
+        point(x2 + y, y2 + x, colour);
+        point(x1 - y, y2 + x, colour);
+        point(x2 + y, y1 - x, colour);
+        point(x1 - y, y1 - x, colour);
+    }
+}
+
+void hV_Screen_Buffer::s_roundArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour)
+{
+    int16_t f = 1 - radius;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * radius;
+    int16_t x = 0;
+    int16_t y = radius;
+
+    while (x <= y)
     {
-        point(x0, y0 + radius, colour);
-        point(x0, y0 - radius, colour);
-        point(x0 + radius, y0, colour);
-        point(x0 - radius, y0, colour);
+        // Rows at distance x, half-width y
+        if (x == 0)
+        {
+            s_setArea(max((int32_t)x1 - y, (int32_t)0), y1, x2 + y, y2, colour); // middle
+        }
+        else
+        {
+            s_setRow((int32_t)x1 - y, (int32_t)x2 + y, (int32_t)y1 - x, colour); // top
+            s_setRow((int32_t)x1 - y, (int32_t)x2 + y, (int32_t)y2 + x, colour); // bottom
+        }
 
-        while (x < y)
+        if (f >= 0)
         {
-            if (f >= 0)
+            // Rows at distance y, half-width x, last point before y changes
+            if (y > x)
             {
-                y--;
-                ddF_y += 2;
-                f += ddF_y;
+                s_setRow((int32_t)x1 - x, (int32_t)x2 + x, (int32_t)y1 - y, colour); // top
+                s_setRow((int32_t)x1 - x, (int32_t)x2 + x, (int32_t)y2 + y, colour); // bottom
             }
 
-            x++;
-            ddF_x += 2;
-            f += ddF_x;
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
 
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+    }
+}
+
+void hV_Screen_Buffer::ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour)
+{
+    if ((radiusX == 0) or (radiusY == 0))
+    {
+        line((x0 > radiusX) ? x0 - radiusX : 0, (y0 > radiusY) ? y0 - radiusY : 0, x0 + radiusX, y0 + radiusY, colour);
+        return;
+    }
+
+    // Bresenham-type algorithm, two sets of points for the first quadrant
+    int32_t twoASquare = 2 * (int32_t)radiusX * radiusX;
+    int32_t twoBSquare = 2 * (int32_t)radiusY * radiusY;
+    int32_t x, y, changeX, changeY, error, stopX, stopY;
+    int32_t yLast = -1; // last row of the first set
+    int32_t yRow = -1; // row of the last point, not drawn yet
+
+    // First set, from (radiusX, 0), one row per point
+    x = radiusX;
+    y = 0;
+    changeX = (int32_t)radiusY * radiusY * (1 - 2 * (int32_t)radiusX);
+    changeY = (int32_t)radiusX * radiusX;
+    error = 0;
+    stopX = twoBSquare * radiusX;
+    stopY = 0;
+
+    while (stopX >= stopY)
+    {
+        if (v_penSolid == false)
+        {
             point(x0 + x, y0 + y, colour);
             point(x0 - x, y0 + y, colour);
             point(x0 + x, y0 - y, colour);
             point(x0 - x, y0 - y, colour);
-            point(x0 + y, y0 + x, colour);
-            point(x0 - y, y0 + x, colour);
-            point(x0 + y, y0 - x, colour);
-            point(x0 - y, y0 - x, colour);
+        }
+        else if (y == 0)
+        {
+            s_setRow((int32_t)x0 - x, (int32_t)x0 + x, y0, colour);
+        }
+        else
+        {
+            s_setRow((int32_t)x0 - x, (int32_t)x0 + x, (int32_t)y0 - y, colour); // top
+            s_setRow((int32_t)x0 - x, (int32_t)x0 + x, (int32_t)y0 + y, colour); // bottom
+        }
+        yLast = y;
+
+        y++;
+        stopY += twoASquare;
+        error += changeY;
+        changeY += twoASquare;
+        if ((2 * error + changeX) > 0)
+        {
+            x--;
+            stopX -= twoBSquare;
+            error += changeX;
+            changeX += twoBSquare;
         }
     }
-    else
+
+    // Second set, from (0, radiusY), rows not covered by the first set
+    int32_t xPoint = 0; // last point
+    int32_t yPoint = radiusY;
+    x = 0;
+    y = radiusY;
+    changeX = (int32_t)radiusY * radiusY;
+    changeY = (int32_t)radiusX * radiusX * (1 - 2 * (int32_t)radiusY);
+    error = 0;
+    stopX = 0;
+    stopY = twoASquare * radiusY;
+
+    while (stopX <= stopY)
     {
-        while (x < y)
+        if (v_penSolid == false)
         {
-            if (f >= 0)
+            point(x0 + x, y0 + y, colour);
+            point(x0 - x, y0 + y, colour);
+            point(x0 + x, y0 - y, colour);
+            point(x0 - x, y0 - y, colour);
+        }
+        else if (y > yLast)
+        {
+            yRow = y;
+        }
+        xPoint = x;
+        yPoint = y;
+
+        x++;
+        stopX += twoBSquare;
+        error += changeX;
+        changeX += twoBSquare;
+        if ((2 * error + changeY) > 0)
+        {
+            // Last point on the row
+            if (yRow >= 0)
             {
-                y--;
-                ddF_y += 2;
-                f += ddF_y;
+                s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 - yRow, colour); // top
+                s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 + yRow, colour); // bottom
+                yRow = -1;
             }
 
-            x++;
-            ddF_x += 2;
-            f += ddF_x;
-
-            line(x0 + x, y0 + y, x0 - x, y0 + y, colour); // bottom
-            line(x0 + x, y0 - y, x0 - x, y0 - y, colour); // top
-            line(x0 + y, y0 - x, x0 + y, y0 + x, colour); // right
-            line(x0 - y, y0 - x, x0 - y, y0 + x, colour); // left
+            y--;
+            stopY -= twoASquare;
+            error += changeY;
+            changeY += twoASquare;
         }
+    }
+
+    if (yRow >= 0)
+    {
+        s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 - yRow, colour); // top
+        s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 + yRow, colour); // bottom
+    }
 
-        setPenSolid(true);
-        rectangle(x0 - x, y0 - y, x0 + x, y0 + y, colour);
+    // Rows between both sets, for elongated ellipses
+    for (y = yPoint - 1; y > yLast; y--)
+    {
+        if (v_penSolid == false)
+        {
+            point(x0 + xPoint, y0 + y, colour);
+            point(x0 - xPoint, y0 + y, colour);
+            point(x0 + xPoint, y0 - y, colour);
+            point(x0 - xPoint, y0 - y, colour);
+        }
+        else
+        {
+            s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 - y, colour); // top
+            s_setRow((int32_t)x0 - xPoint, (int32_t)x0 + xPoint, (int32_t)y0 + y, colour); // bottom
+        }
     }
 }
 
@@ -228,10 +390,7 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
         {
             hV_HAL_swap(y1, y2);
         }
-        for (uint16_t y = y1; y <= y2; y++)
-        {
-            s_setPoint(x1, y, colour);
-        }
+        s_setArea(x1, y1, x1, y2, colour);
     }
     else if (y1 == y2)
     {
@@ -239,10 +398,7 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
         {
             hV_HAL_swap(x1, x2);
         }
-        for (uint16_t x = x1; x <= x2; x++)
-        {
-            s_setPoint(x, y1, colour);
-        }
+        s_setArea(x1, y1, x2, y1, colour);
     }
     else
     {
@@ -304,6 +460,11 @@ void hV_Screen_Buffer::setPenSolid(bool flag)
     v_penSolid = flag;
 }
 
+bool hV_Screen_Buffer::getPenSolid()
+{
+    return v_penSolid;
+}
+
 void hV_Screen_Buffer::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
     s_setPoint(x1, y1, colour);
@@ -328,117 +489,141 @@ void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
         {
             hV_HAL_swap(y1, y2);
         }
-        for (uint16_t x = x1; x <= x2; x++)
-        {
-            for (uint16_t y = y1; y <= y2; y++)
-            {
-                s_setPoint(x, y, colour);
-            }
-        }
+        s_setArea(x1, y1, x2, y2, colour);
     }
 }
 
-void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+void hV_Screen_Buffer::roundRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour)
 {
-    rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+    if (x1 > x2)
+    {
+        hV_HAL_swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        hV_HAL_swap(y1, y2);
+    }
+    radius = min(radius, (uint16_t)(min(x2 - x1, y2 - y1) / 2));
+
+    if (v_penSolid == false)
+    {
+        line(x1 + radius, y1, x2 - radius, y1, colour); // top
+        line(x1 + radius, y2, x2 - radius, y2, colour); // bottom
+        line(x1, y1 + radius, x1, y2 - radius, colour); // left
+        line(x2, y1 + radius, x2, y2 - radius, colour); // right
+        s_roundOutline(x1 + radius, y1 + radius, x2 - radius, y2 - radius, radius, colour);
+    }
+    else
+    {
+        s_roundArea(x1 + radius, y1 + radius, x2 - radius, y2 - radius, radius, colour);
+    }
 }
 
-void hV_Screen_Buffer::s_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+void hV_Screen_Buffer::s_setRow(int32_t x1, int32_t x2, int32_t y1, uint16_t colour)
 {
-    int16_t wx1 = (int16_t)x1;
-    int16_t wy1 = (int16_t)y1;
-    int16_t wx2 = (int16_t)x2;
-    int16_t wy2 = (int16_t)y2;
-    int16_t wx3 = (int16_t)x3;
-    int16_t wy3 = (int16_t)y3;
-    int16_t wx4 = wx1;
-    int16_t wy4 = wy1;
-    int16_t wx5 = wx1;
-    int16_t wy5 = wy1;
-
-    bool changed1 = false;
-    bool changed2 = false;
+    if ((y1 < 0) or (x2 < 0))
+    {
+        return;
+    }
+    s_setArea(max(x1, (int32_t)0), y1, x2, y1, colour);
+}
 
-    int16_t dx1 = abs(wx2 - wx1);
-    int16_t dy1 = abs(wy2 - wy1);
+void hV_Screen_Buffer::s_setColumn(uint16_t x1, uint16_t y1, uint32_t bits, uint8_t height, uint16_t textColour, uint16_t backColour, bool flagSolid)
+{
+    for (uint8_t j = 0; j < height; j++)
+    {
+        if (bitRead(bits, j))
+        {
+            s_setPoint(x1, y1 + j, textColour);
+        }
+        else if (flagSolid)
+        {
+            s_setPoint(x1, y1 + j, backColour);
+        }
+    }
+}
 
-    int16_t dx2 = abs(wx3 - wx1);
-    int16_t dy2 = abs(wy3 - wy1);
+void hV_Screen_Buffer::s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        for (uint16_t y = y1; y <= y2; y++)
+        {
+            s_setPoint(x, y, colour);
+        }
+    }
+}
 
-    int16_t signx1 = (wx2 >= wx1) ? +1 : -1;
-    int16_t signx2 = (wx3 >= wx1) ? +1 : -1;
+void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+{
+    rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+}
 
-    int16_t signy1 = (wy2 >= wy1) ? +1 : -1;
-    int16_t signy2 = (wy3 >= wy1) ? +1 : -1;
+///
+/// @brief Ceiling of integer division
+/// @param n numerator
+/// @param d denominator, d > 0
+/// @return smallest integer >= n / d
+///
+static inline int32_t ceilDivide(int32_t n, int32_t d)
+{
+    return (n >= 0) ? (n + d - 1) / d : -((-n) / d);
+}
 
-    if (dy1 > dx1)
+void hV_Screen_Buffer::s_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+{
+    // Sort by ascending y
+    if (y1 > y2)
     {
-        hV_HAL_swap(dx1, dy1); // swap values
-        changed1 = true;
+        hV_HAL_swap(x1, x2);
+        hV_HAL_swap(y1, y2);
     }
-
-    if (dy2 > dx2)
+    if (y2 > y3)
     {
-        hV_HAL_swap(dx2, dy2); // swap values
-        changed2 = true;
+        hV_HAL_swap(x2, x3);
+        hV_HAL_swap(y2, y3);
+    }
+    if (y1 > y2)
+    {
+        hV_HAL_swap(x1, x2);
+        hV_HAL_swap(y1, y2);
     }
 
-    int16_t e1 = 2 * dy1 - dx1;
-    int16_t e2 = 2 * dy2 - dx2;
+    // Side of point 2 against edge 1-3, negative = left
+    int32_t cross = ((int32_t)x2 - x1) * ((int32_t)y3 - y1) - ((int32_t)x3 - x1) * ((int32_t)y2 - y1);
 
-    for (int i = 0; i <= dx1; i++)
+    // Aligned points, no area
+    if (cross == 0)
     {
-        line(wx4, wy4, wx5, wy5, colour);
-
-        while (e1 >= 0)
-        {
-            if (changed1)
-            {
-                wx4 += signx1;
-            }
-            else
-            {
-                wy4 += signy1;
-            }
-            e1 = e1 - 2 * dx1;
-        }
+        line(x1, y1, x2, y2, colour);
+        line(x2, y2, x3, y3, colour);
+        return;
+    }
 
-        if (changed1)
+    // Top-left rule, pixel (x, y) filled if xLeft <= x < xRight and y1 <= y < y3
+    // Edges shared by adjacent triangles filled once
+    int32_t xLong, xShort;
+    for (int32_t y = y1; y < y3; y++)
+    {
+        xLong = x1 + ceilDivide((y - y1) * ((int32_t)x3 - x1), (int32_t)y3 - y1);
+        if (y < y2)
         {
-            wy4 += signy1;
+            xShort = x1 + ceilDivide((y - y1) * ((int32_t)x2 - x1), (int32_t)y2 - y1);
         }
         else
         {
-            wx4 += signx1;
+            xShort = x2 + ceilDivide((y - y2) * ((int32_t)x3 - x2), (int32_t)y3 - y2);
         }
 
-        e1 = e1 + 2 * dy1;
-
-        while (wy5 != wy4)
+        if (cross > 0)
         {
-            while (e2 >= 0)
-            {
-                if (changed2)
-                {
-                    wx5 += signx2;
-                }
-                else
-                {
-                    wy5 += signy2;
-                }
-                e2 = e2 - 2 * dx2;
-            }
-
-            if (changed2)
-            {
-                wy5 += signy2;
-            }
-            else
-            {
-                wx5 += signx2;
-            }
+            hV_HAL_swap(xLong, xShort); // xShort on the left
+        }
 
-            e2 = e2 + 2 * dy2;
+        // One span per row
+        if (xShort < xLong)
+        {
+            s_setArea(xShort, y, xLong - 1, y, colour);
         }
     }
 }
@@ -459,57 +644,7 @@ void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
     }
     else if (v_penSolid)
     {
-        bool b = true;
-
-        // Graham Scan + Andrew's Monotone Chain Algorithm
-        // Sort by ascending y
-        while (b)
-        {
-            b = false;
-            if ((b == false) and (y1 > y2))
-            {
-                hV_HAL_swap(x1, x2);
-                hV_HAL_swap(y1, y2);
-                b = true;
-            }
-            if ((b == false) and (y2 > y3))
-            {
-                hV_HAL_swap(x3, x2);
-                hV_HAL_swap(y3, y2);
-                b = true;
-            }
-        }
-
-        if (y2 == y3)
-        {
-            s_triangleArea(x1, y1, x2, y2, x3, y3, colour);
-        }
-        else if (y1 == y2)
-        {
-            s_triangleArea(x3, y3, x1, y1, x2, y2, colour);
-        }
-        else
-        {
-            uint16_t x4 = (uint16_t)((int32_t)x1 + (y2 - y1) * (x3 - x1) / (y3 - y1));
-            uint16_t y4 = y2;
-
-            s_triangleArea(x1, y1, x2, y2, x4, y4, colour);
-
-#if defined(ESP8266)
-            delay(1);
-#else
-            delayMicroseconds(1000); // delay(1);
-#endif // ESP8266
-
-            delayMicroseconds(1000); // delay(1);
-            s_triangleArea(x3, y3, x2, y2, x4, y4, colour);
-
-#if defined(ESP8266)
-            delay(1);
-#else
-            delayMicroseconds(1000); // delay(1);
-#endif // ESP8266
-        }
+        s_triangleArea(x1, y1, x2, y2, x3, y3, colour);
     }
     else
     {
@@ -527,6 +662,11 @@ void hV_Screen_Buffer::setFontSolid(bool flag)
     f_setFontSolid(flag);
 }
 
+bool hV_Screen_Buffer::getFontSolid()
+{
+    return f_fontSolid;
+}
+
 uint8_t hV_Screen_Buffer::addFont(font_s fontName)
 {
     return f_addFont(fontName);
@@ -599,156 +739,38 @@ void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
 {
 #if (FONT_MODE == USE_FONT_TERMINAL)
 
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+    uint8_t width = f_font.maxWidth;
 
-#if (MAX_FONT_SIZE > 0)
-
-    if (f_fontSize == 0)
+    for (uint8_t k = 0; k < text.length(); k++)
     {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
-
-            for (i = 0; i < 6; i++)
-            {
-                line = f_getCharacter(c, i);
-
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 6 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 6 * k + i, y0 + j, backColour);
-                    }
-                }
-            }
-        }
+        s_setCharacter(x0 + width * k, y0, text.charAt(k) - ' ', textColour, backColour);
     }
 
-#if (MAX_FONT_SIZE > 1)
-
-    else if (f_fontSize == 1)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
+#endif // FONT_MODE
+}
 
-            for (i = 0; i < 8; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+void hV_Screen_Buffer::s_setCharacter(uint16_t x0, uint16_t y0, uint8_t character, uint16_t textColour, uint16_t backColour)
+{
+#if (FONT_MODE == USE_FONT_TERMINAL)
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 8 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if ((f_fontSolid) and (j < 4))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
-            }
-        }
-    }
+    uint32_t bits;
 
-#if (MAX_FONT_SIZE > 2)
+    // One, two or three bytes per column
+    uint8_t width = f_font.maxWidth;
+    uint8_t height = f_font.height;
+    uint8_t bytes = (height + 7) / 8;
 
-    else if (f_fontSize == 2)
+    for (uint8_t i = 0; i < width; i++)
     {
-
-        for (k = 0; k < text.length(); k++)
+        bits = 0;
+        for (uint8_t b = 0; b < bytes; b++)
         {
-            c = text.charAt(k) - ' ';
-
-            for (i = 0; i < 12; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
-
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
-            }
+            bits |= (uint32_t)f_getCharacter(character, bytes * i + b) << (8 * b);
         }
-    }
-#if (MAX_FONT_SIZE > 3)
 
-    else if (f_fontSize == 3)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
-            for (i = 0; i < 16; i++)
-            {
-                line = f_getCharacter(c, 3 * i);
-                line1 = f_getCharacter(c, 3 * i + 1);
-                line2 = f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, backColour);
-                    }
-                    if (bitRead(line2, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, backColour);
-                    }
-                }
-            }
-        }
+        s_setColumn(x0 + i, y0, bits, height, textColour, backColour, f_fontSolid);
     }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
+
 #endif // FONT_MODE
 }
 
@@ -928,6 +950,76 @@ void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
 
     setPenSolid(oldPenSolid);
 
+#endif // FONT_MODE
+}
+
+void hV_Screen_Buffer::gTextScaled(uint16_t x0, uint16_t y0,
+                                   String text,
+                                   uint8_t scaleX, uint8_t scaleY,
+                                   uint16_t textColour,
+                                   uint16_t backColour)
+{
+#if (FONT_MODE == USE_FONT_TERMINAL)
+
+    uint32_t columns[32]; // one column per element, one bit per pixel
+    uint16_t x, y;
+    uint8_t i, j, k, b, i1;
+    bool flag;
+
+    // One, two or three bytes per column
+    uint8_t width = min(f_font.maxWidth, (uint8_t)32);
+    uint8_t height = f_font.height;
+    uint8_t bytes = (height + 7) / 8;
+
+    scaleX = max(scaleX, (uint8_t)1);
+    scaleY = max(scaleY, (uint8_t)1);
+
+    for (k = 0; k < text.length(); k++)
+    {
+        x = x0 + width * k * scaleX;
+        uint8_t c = text.charAt(k) - ' ';
+
+        for (i = 0; i < width; i++)
+        {
+            columns[i] = 0;
+            for (b = 0; b < bytes; b++)
+            {
+                columns[i] |= (uint32_t)f_getCharacter(c, bytes * i + b) << (8 * b);
+            }
+        }
+
+        // Line by line, one area per run of identical pixels
+        for (j = 0; j < height; j++)
+        {
+            y = y0 + j * scaleY;
+            i1 = 0;
+            flag = bitRead(columns[0], j);
+
+            for (i = 1; i <= width; i++)
+            {
+                if ((i < width) and (bitRead(columns[i], j) == flag))
+                {
+                    continue;
+                }
+
+                if (flag)
+                {
+                    s_setArea(x + i1 * scaleX, y, x + i * scaleX - 1, y + scaleY - 1, textColour);
+                }
+                else if (f_fontSolid)
+                {
+                    s_setArea(x + i1 * scaleX, y, x + i * scaleX - 1, y + scaleY - 1, backColour);
+                }
+
+                if (i < width)
+                {
+                    i1 = i;
+                    flag = bitRead(columns[i], j);
+                }
+            }
+        }
+    }
+
 #endif // FONT_MODE
 }
 //
@@ -6,8 +6,8 @@
 /// @n Based on highView technology
 ///
 /// @author Rei Vilo
-/// @date 21 Jan 2025
-/// @version 812
+/// @date 17 Oct 2026
+/// @version 830
 ///
 /// @copyright (c) Rei Vilo, 2010-2025
 /// @copyright All rights reserved
@@ -42,7 +42,7 @@
 ///
 /// @brief Library release number
 ///
-#define hV_SCREEN_BUFFER_RELEASE 812
+#define hV_SCREEN_BUFFER_RELEASE 830
 
 // Other libraries
 #include "hV_Colours565.h"
@@ -162,11 +162,26 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @param y0 center, point coordinate, y-axis
     /// @param radius radius
     /// @param colour 16-bit colour
+    /// @note Solid circle filled row by row, outline included
     ///
     /// @n @b More: @ref Coordinate, @ref Colour
     ///
     virtual void circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour);
 
+    ///
+    /// @brief Draw ellipse
+    /// @param x0 center, point coordinate, x-axis
+    /// @param y0 center, point coordinate, y-axis
+    /// @param radiusX radius, x-axis
+    /// @param radiusY radius, y-axis
+    /// @param colour 16-bit colour
+    /// @note Solid ellipse filled row by row, outline included
+    /// @note If one radius is 0, draw a line
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour);
+
     ///
     /// @brief Draw line, rectangle coordinates
     /// @param x1 top left coordinate, x-axis
@@ -197,6 +212,12 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setPenSolid(bool flag = true);
 
+    ///
+    /// @brief Get pen opaque
+    /// @return true = opaque = solid, false = wire frame
+    ///
+    virtual bool getPenSolid();
+
     ///
     /// @brief Draw triangle, rectangle coordinates
     /// @param x1 first point coordinate, x-axis
@@ -207,6 +228,8 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @param y3 third point coordinate, y-axis
     /// @param colour 16-bit colour
     /// @note If two points are equal, draw a line
+    /// @note Solid triangle filled with the top-left rule: pixels on the bottom and right edges
+    /// left to the adjacent triangle, so triangles sharing an edge neither overlap nor leave a gap
     ///
     /// @n @b More: @ref Coordinate, @ref Colour
     ///
@@ -224,6 +247,20 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
 
+    ///
+    /// @brief Draw rectangle with rounded corners, rectangle coordinates
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param radius radius of the corners, limited to half the smaller side
+    /// @param colour 16-bit colour
+    /// @note Solid rectangle filled row by row
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void roundRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour);
+
     ///
     /// @brief Draw rectangle, vector coordinates
     /// @param x0 point coordinate, x-axis
@@ -278,6 +315,12 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setFontSolid(bool flag = true);
 
+    ///
+    /// @brief Get transparent or opaque text
+    /// @return true = opaque = solid, false = transparent
+    ///
+    virtual bool getFontSolid();
+
     ///
     /// @brief Set additional spaces between two characters, horizontal axis
     /// @param number of spaces default = 1 pixel
@@ -366,6 +409,26 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
                             String text,
                             uint16_t textColour = myColours.black,
                             uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) scaled by integer factors
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text text string
+    /// @param scaleX horizontal factor, 1 or more
+    /// @param scaleY vertical factor, 1 or more
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @details Consecutive pixels on a line of the glyph drawn as one area
+    /// @note Same result as gTextLarge() with scaleX = scaleY = 2, pen unchanged
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    virtual void gTextScaled(uint16_t x0, uint16_t y0,
+                             String text,
+                             uint8_t scaleX, uint8_t scaleY,
+                             uint16_t textColour = myColours.black,
+                             uint16_t backColour = myColours.white);
     /// @}
 
     //
@@ -405,12 +468,86 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour) = 0; // compulsory
 
+    ///
+    /// @brief Set area
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are sorted, x1 <= x2 and y1 <= y2
+    /// @note Default implementation calls s_setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set column of a glyph
+    /// @param x1 coordinate, x-axis
+    /// @param y1 top coordinate, y-axis
+    /// @param bits one bit per pixel, bit 0 at y1
+    /// @param height number of pixels, up to 32
+    /// @param textColour 16-bit colour for bits set
+    /// @param backColour 16-bit colour for bits cleared
+    /// @param flagSolid true = bits cleared with backColour, false = unchanged
+    /// @note Default implementation calls s_setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void s_setColumn(uint16_t x1, uint16_t y1, uint32_t bits, uint8_t height, uint16_t textColour, uint16_t backColour, bool flagSolid);
+
+    ///
+    /// @brief Set character of the selected font
+    /// @param x0 left coordinate, x-axis
+    /// @param y0 top coordinate, y-axis
+    /// @param character character index, ASCII code - 32
+    /// @param textColour 16-bit colour for the glyph
+    /// @param backColour 16-bit colour for the background, if font solid
+    /// @note Default implementation calls s_setColumn() for each column
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void s_setCharacter(uint16_t x0, uint16_t y0, uint8_t character, uint16_t textColour, uint16_t backColour);
+
     // Write and Read
 
     // Other functions
+    // required by circle(), ellipse(), roundRectangle() and triangle()
+    ///
+    /// @brief Set horizontal span, clipped
+    /// @param x1 first point coordinate, x-axis, may be negative
+    /// @param x2 last point coordinate, x-axis, may be negative
+    /// @param y1 coordinate, y-axis, may be negative
+    /// @param colour 16-bit colour
+    ///
+    void s_setRow(int32_t x1, int32_t x2, int32_t y1, uint16_t colour);
+
+    // required by circle() and roundRectangle()
+    ///
+    /// @brief Rounded area utility, midpoint algorithm
+    /// @param x1 centre of the left corners, x-axis
+    /// @param y1 centre of the top corners, y-axis
+    /// @param x2 centre of the right corners, x-axis
+    /// @param y2 centre of the bottom corners, y-axis
+    /// @param radius radius of the corners
+    /// @param colour 16-bit colour
+    /// @note Each row drawn once, as one span
+    ///
+    void s_roundArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour);
+
+    ///
+    /// @brief Rounded outline utility, midpoint algorithm
+    /// @param x1 centre of the left corners, x-axis
+    /// @param y1 centre of the top corners, y-axis
+    /// @param x2 centre of the right corners, x-axis
+    /// @param y2 centre of the bottom corners, y-axis
+    /// @param radius radius of the corners
+    /// @param colour 16-bit colour
+    /// @note Corners only, straight sides drawn by the caller
+    ///
+    void s_roundOutline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour);
+
     // required by triangle()
     ///
-    /// @brief Triangle utility
+    /// @brief Triangle utility, scanline rasteriser
     /// @param x1 first point coordinate, x-axis
     /// @param y1 first point coordinate, y-axis
     /// @param x2 second point coordinate, x-axis
@@ -418,6 +555,7 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @param x3 third point coordinate, x-axis
     /// @param y3 third point coordinate, y-axis
     /// @param colour 16-bit colour
+    /// @note One span per row with s_setArea(), top-left rule
     ///
     void s_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
 
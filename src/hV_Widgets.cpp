@@ -0,0 +1,588 @@
+//
+// hV_Widgets.cpp
+// Class library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2026
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Widgets.h for references
+//
+// Release 830: Added retained widgets with damage tracking
+//
+
+// Library header
+#include "hV_Widgets.h"
+
+// Code
+hV_Widgets::hV_Widgets(hV_Screen_Buffer * screen)
+{
+    w_screen = screen;
+    w_widgets = 0; // nullptr
+    w_number = 0;
+    w_flagDamage = false;
+    w_countDrawn = 0;
+    w_countSkipped = 0;
+}
+
+void hV_Widgets::begin(widget_s * buffer, uint8_t number)
+{
+    w_widgets = buffer;
+    w_number = (buffer != 0) ? number : 0;
+
+    for (uint8_t index = 0; index < w_number; index++)
+    {
+        w_widgets[index].type = WIDGET_NONE;
+    }
+
+    w_flagDamage = false;
+    w_countDrawn = 0;
+    w_countSkipped = 0;
+}
+
+uint8_t hV_Widgets::w_add(uint8_t type)
+{
+    for (uint8_t index = 0; index < w_number; index++)
+    {
+        if (w_widgets[index].type == WIDGET_NONE)
+        {
+            widget_s * widget = &w_widgets[index];
+            memset(widget, 0x00, sizeof(widget_s));
+            widget->type = type;
+            widget->orientation = w_screen->getOrientation();
+            widget->font = w_screen->getFont();
+            return index;
+        }
+    }
+
+    mySerial.println("hV * Widgets full");
+    return WIDGET_ERROR;
+}
+
+uint8_t hV_Widgets::addLabel(uint16_t x0, uint16_t y0, String text, uint8_t length,
+                             uint16_t colour, uint16_t backColour)
+{
+    if (length == 0)
+    {
+        return WIDGET_ERROR;
+    }
+
+    uint8_t handle = w_add(WIDGET_LABEL);
+    if (handle != WIDGET_ERROR)
+    {
+        widget_s * widget = &w_widgets[handle];
+        widget->length = min(length, (uint8_t)WIDGET_TEXT);
+        widget->x1 = x0;
+        widget->y1 = y0;
+        widget->x2 = x0 + widget->length * w_screen->characterSizeX() - 1;
+        widget->y2 = y0 + w_screen->characterSizeY() - 1;
+        widget->colour = colour;
+        widget->backColour = backColour;
+        setText(handle, text);
+    }
+    return handle;
+}
+
+uint8_t hV_Widgets::addNumber(uint16_t x0, uint16_t y0, uint8_t length, uint8_t decimals,
+                              uint16_t colour, uint16_t backColour)
+{
+    if (length == 0)
+    {
+        return WIDGET_ERROR;
+    }
+
+    uint8_t handle = w_add(WIDGET_NUMBER);
+    if (handle != WIDGET_ERROR)
+    {
+        widget_s * widget = &w_widgets[handle];
+        widget->length = min(length, (uint8_t)WIDGET_TEXT);
+        widget->decimals = decimals;
+        widget->x1 = x0;
+        widget->y1 = y0;
+        widget->x2 = x0 + widget->length * w_screen->characterSizeX() - 1;
+        widget->y2 = y0 + w_screen->characterSizeY() - 1;
+        widget->colour = colour;
+        widget->backColour = backColour;
+        w_formatNumber(widget);
+    }
+    return handle;
+}
+
+uint8_t hV_Widgets::addBar(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                           int32_t minimum, int32_t maximum,
+                           uint16_t colour, uint16_t backColour)
+{
+    uint8_t handle = w_add(WIDGET_BAR);
+    if (handle != WIDGET_ERROR)
+    {
+        widget_s * widget = &w_widgets[handle];
+        widget->x1 = min(x1, x2);
+        widget->y1 = min(y1, y2);
+        widget->x2 = max(x1, x2);
+        widget->y2 = max(y1, y2);
+        widget->minimum = min(minimum, maximum);
+        widget->maximum = max(minimum, maximum);
+        widget->colour = colour;
+        widget->backColour = backColour;
+        widget->value = widget->minimum;
+    }
+    return handle;
+}
+
+uint8_t hV_Widgets::addIcon(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height,
+                            const uint8_t * bitmap, uint8_t frames,
+                            uint16_t colour, uint16_t backColour)
+{
+    if ((bitmap == 0) or (frames == 0) or (width == 0) or (height == 0))
+    {
+        return WIDGET_ERROR;
+    }
+
+    uint8_t handle = w_add(WIDGET_ICON);
+    if (handle != WIDGET_ERROR)
+    {
+        widget_s * widget = &w_widgets[handle];
+        widget->length = frames;
+        widget->x1 = x0;
+        widget->y1 = y0;
+        widget->x2 = x0 + width - 1;
+        widget->y2 = y0 + height - 1;
+        widget->bitmap = bitmap;
+        widget->colour = colour;
+        widget->backColour = backColour;
+    }
+    return handle;
+}
+
+void hV_Widgets::setText(uint8_t handle, String text)
+{
+    if ((handle >= w_number) or (w_widgets[handle].type != WIDGET_LABEL))
+    {
+        return;
+    }
+
+    // Padded with spaces, so shorter text erases the previous one
+    widget_s * widget = &w_widgets[handle];
+    for (uint8_t k = 0; k < widget->length; k++)
+    {
+        widget->text[k] = (k < text.length()) ? text.charAt(k) : ' ';
+    }
+    widget->text[widget->length] = 0x00;
+}
+
+void hV_Widgets::setValue(uint8_t handle, int32_t value)
+{
+    if (handle >= w_number)
+    {
+        return;
+    }
+
+    widget_s * widget = &w_widgets[handle];
+    switch (widget->type)
+    {
+        case WIDGET_NUMBER:
+
+            widget->value = value;
+            w_formatNumber(widget);
+            break;
+
+        case WIDGET_BAR:
+
+            widget->value = min(max(value, widget->minimum), widget->maximum);
+            break;
+
+        case WIDGET_ICON:
+
+            widget->value = min(max(value, (int32_t)0), (int32_t)(widget->length - 1));
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+int32_t hV_Widgets::getValue(uint8_t handle)
+{
+    return (handle < w_number) ? w_widgets[handle].value : 0;
+}
+
+void hV_Widgets::w_formatNumber(widget_s * widget)
+{
+    // Digits from right to left, then sign, padded with spaces
+    char * text = widget->text;
+    uint32_t magnitude = (widget->value < 0) ? -(uint32_t)widget->value : (uint32_t)widget->value;
+    int8_t index = widget->length;
+    uint8_t digits = 0;
+    bool flagPoint = (widget->decimals == 0);
+
+    text[index] = 0x00;
+    do
+    {
+        if ((digits == widget->decimals) and (not flagPoint))
+        {
+            text[--index] = '.';
+            flagPoint = true;
+        }
+        else
+        {
+            text[--index] = '0' + (magnitude % 10);
+            magnitude /= 10;
+            digits++;
+        }
+    }
+    while ((index > 0) and ((magnitude > 0) or (digits <= widget->decimals)));
+
+    if ((widget->value < 0) and (index > 0))
+    {
+        text[--index] = '-';
+    }
+
+    // Overflow
+    if ((magnitude > 0) or ((widget->value < 0) and (text[index] != '-')))
+    {
+        memset(text, '#', widget->length);
+        index = 0;
+    }
+
+    while (index > 0)
+    {
+        text[--index] = ' ';
+    }
+}
+
+void hV_Widgets::invalidate()
+{
+    for (uint8_t index = 0; index < w_number; index++)
+    {
+        w_widgets[index].flagDrawn = false;
+    }
+}
+
+void hV_Widgets::w_addDamage(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (not w_flagDamage)
+    {
+        w_damageX1 = x1;
+        w_damageY1 = y1;
+        w_damageX2 = x2;
+        w_damageY2 = y2;
+        w_flagDamage = true;
+    }
+    else
+    {
+        w_damageX1 = min(w_damageX1, x1);
+        w_damageY1 = min(w_damageY1, y1);
+        w_damageX2 = max(w_damageX2, x2);
+        w_damageY2 = max(w_damageY2, y2);
+    }
+}
+
+bool hV_Widgets::w_drawText(widget_s * widget)
+{
+    uint16_t width = w_screen->characterSizeX();
+    uint8_t first = 0;
+    uint8_t last = widget->length;
+
+    if (widget->flagDrawn)
+    {
+        // Changed characters only
+        while ((first < widget->length) and (widget->text[first] == widget->drawn[first]))
+        {
+            first++;
+        }
+        if (first == widget->length)
+        {
+            return false;
+        }
+        while (widget->text[last - 1] == widget->drawn[last - 1])
+        {
+            last--;
+        }
+    }
+    else
+    {
+        w_screen->setPenSolid(true);
+        w_screen->rectangle(widget->x1, widget->y1, widget->x2, widget->y2, widget->backColour);
+    }
+
+    w_screen->setFontSolid(true);
+    for (uint8_t k = first; k < last; k++)
+    {
+        if ((not widget->flagDrawn) or (widget->text[k] != widget->drawn[k]))
+        {
+            w_screen->gText(widget->x1 + k * width, widget->y1, String(widget->text[k]), widget->colour, widget->backColour);
+        }
+    }
+    memcpy(widget->drawn, widget->text, widget->length + 1);
+
+    w_addDamage(widget->x1 + first * width, widget->y1, widget->x1 + last * width - 1, widget->y2);
+    return true;
+}
+
+bool hV_Widgets::w_drawBar(widget_s * widget)
+{
+    if (widget->flagDrawn and (widget->value == widget->last))
+    {
+        return false;
+    }
+
+    // Position in pixels, from 0 = empty to size = full
+    bool flagHorizontal = ((widget->x2 - widget->x1) >= (widget->y2 - widget->y1));
+    int32_t size = flagHorizontal ? (widget->x2 - widget->x1 + 1) : (widget->y2 - widget->y1 + 1);
+    int32_t range = widget->maximum - widget->minimum;
+    int32_t position = (range > 0) ? (int32_t)((int64_t)(widget->value - widget->minimum) * size / range) : 0;
+    int32_t previous = (range > 0) ? (int32_t)((int64_t)(widget->last - widget->minimum) * size / range) : 0;
+    widget->last = widget->value;
+
+    if (not widget->flagDrawn)
+    {
+        previous = 0;
+        w_screen->setPenSolid(true);
+        w_screen->rectangle(widget->x1, widget->y1, widget->x2, widget->y2, widget->backColour);
+        w_addDamage(widget->x1, widget->y1, widget->x2, widget->y2);
+    }
+
+    if (position == previous)
+    {
+        return not widget->flagDrawn;
+    }
+
+    // Changed part only, filled with colour when growing, with back colour when shrinking
+    uint16_t colour = (position > previous) ? widget->colour : widget->backColour;
+    int32_t from = min(position, previous);
+    int32_t to = max(position, previous) - 1;
+
+    uint16_t x1, y1, x2, y2;
+    if (flagHorizontal)
+    {
+        x1 = widget->x1 + from;
+        x2 = widget->x1 + to;
+        y1 = widget->y1;
+        y2 = widget->y2;
+    }
+    else
+    {
+        x1 = widget->x1;
+        x2 = widget->x2;
+        y1 = widget->y2 - to;
+        y2 = widget->y2 - from;
+    }
+
+    w_screen->setPenSolid(true);
+    w_screen->rectangle(x1, y1, x2, y2, colour);
+    w_addDamage(x1, y1, x2, y2);
+    return true;
+}
+
+bool hV_Widgets::w_drawIcon(widget_s * widget)
+{
+    if (widget->flagDrawn and (widget->value == widget->last))
+    {
+        return false;
+    }
+    widget->last = widget->value;
+
+    uint16_t width = widget->x2 - widget->x1 + 1;
+    uint16_t height = widget->y2 - widget->y1 + 1;
+    uint16_t bytes = (width + 7) / 8;
+    const uint8_t * frame = widget->bitmap + (uint32_t)widget->value * bytes * height;
+
+    // Background, then one point per pixel set
+    w_screen->setPenSolid(true);
+    w_screen->rectangle(widget->x1, widget->y1, widget->x2, widget->y2, widget->backColour);
+    for (uint16_t j = 0; j < height; j++)
+    {
+        for (uint16_t i = 0; i < width; i++)
+        {
+            if (bitRead(frame[j * bytes + i / 8], 7 - (i % 8)))
+            {
+                w_screen->point(widget->x1 + i, widget->y1 + j, widget->colour);
+            }
+        }
+    }
+
+    w_addDamage(widget->x1, widget->y1, widget->x2, widget->y2);
+    return true;
+}
+
+bool hV_Widgets::update(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2)
+{
+    if (w_number == 0)
+    {
+        return false;
+    }
+
+    uint8_t oldOrientation = w_screen->getOrientation();
+    uint8_t oldFont = w_screen->getFont();
+    bool oldPenSolid = w_screen->getPenSolid();
+    bool oldFontSolid = w_screen->getFontSolid();
+
+    // Size of the screen for orientation 0
+    w_screen->setOrientation(0);
+    uint16_t sizeX = w_screen->screenSizeX();
+    uint16_t sizeY = w_screen->screenSizeY();
+
+    // Damage kept for orientation 0, as widgets may have different orientations
+    uint16_t damageX1 = 0, damageY1 = 0, damageX2 = 0, damageY2 = 0;
+    bool flagResult = false;
+
+    for (uint8_t index = 0; index < w_number; index++)
+    {
+        widget_s * widget = &w_widgets[index];
+        if (widget->type == WIDGET_NONE)
+        {
+            continue;
+        }
+
+        w_screen->setOrientation(widget->orientation);
+        w_flagDamage = false;
+
+        bool flagDrawn = false;
+        switch (widget->type)
+        {
+            case WIDGET_LABEL:
+            case WIDGET_NUMBER:
+
+                w_screen->selectFont(widget->font);
+                flagDrawn = w_drawText(widget);
+                break;
+
+            case WIDGET_BAR:
+
+                flagDrawn = w_drawBar(widget);
+                break;
+
+            default: // WIDGET_ICON
+
+                flagDrawn = w_drawIcon(widget);
+                break;
+        }
+        widget->flagDrawn = true;
+
+        if (not(flagDrawn and w_flagDamage))
+        {
+            w_countSkipped++;
+            continue;
+        }
+        w_countDrawn++;
+
+        // Widget orientation to orientation 0
+        uint16_t u1 = w_damageX1, v1 = w_damageY1, u2 = w_damageX2, v2 = w_damageY2;
+        switch (widget->orientation)
+        {
+            case 1: // X = sizeX - 1 - y, Y = x
+
+                u1 = sizeX - 1 - w_damageY2;
+                u2 = sizeX - 1 - w_damageY1;
+                v1 = w_damageX1;
+                v2 = w_damageX2;
+                break;
+
+            case 2: // X = sizeX - 1 - x, Y = sizeY - 1 - y
+
+                u1 = sizeX - 1 - w_damageX2;
+                u2 = sizeX - 1 - w_damageX1;
+                v1 = sizeY - 1 - w_damageY2;
+                v2 = sizeY - 1 - w_damageY1;
+                break;
+
+            case 3: // X = y, Y = sizeY - 1 - x
+
+                u1 = w_damageY1;
+                u2 = w_damageY2;
+                v1 = sizeY - 1 - w_damageX2;
+                v2 = sizeY - 1 - w_damageX1;
+                break;
+
+            default:
+
+                break;
+        }
+
+        if (not flagResult)
+        {
+            damageX1 = u1;
+            damageY1 = v1;
+            damageX2 = u2;
+            damageY2 = v2;
+            flagResult = true;
+        }
+        else
+        {
+            damageX1 = min(damageX1, u1);
+            damageY1 = min(damageY1, v1);
+            damageX2 = max(damageX2, u2);
+            damageY2 = max(damageY2, v2);
+        }
+    }
+
+    w_screen->setOrientation(oldOrientation);
+    w_screen->selectFont(oldFont);
+    w_screen->setPenSolid(oldPenSolid);
+    w_screen->setFontSolid(oldFontSolid);
+
+    if (flagResult)
+    {
+        // Orientation 0 to current orientation
+        switch (oldOrientation)
+        {
+            case 1: // x = Y, y = sizeX - 1 - X
+
+                x1 = damageY1;
+                x2 = damageY2;
+                y1 = sizeX - 1 - damageX2;
+                y2 = sizeX - 1 - damageX1;
+                break;
+
+            case 2: // x = sizeX - 1 - X, y = sizeY - 1 - Y
+
+                x1 = sizeX - 1 - damageX2;
+                x2 = sizeX - 1 - damageX1;
+                y1 = sizeY - 1 - damageY2;
+                y2 = sizeY - 1 - damageY1;
+                break;
+
+            case 3: // x = sizeY - 1 - Y, y = X
+
+                x1 = sizeY - 1 - damageY2;
+                x2 = sizeY - 1 - damageY1;
+                y1 = damageX1;
+                y2 = damageX2;
+                break;
+
+            default:
+
+                x1 = damageX1;
+                y1 = damageY1;
+                x2 = damageX2;
+                y2 = damageY2;
+                break;
+        }
+    }
+    return flagResult;
+}
+
+bool hV_Widgets::flush()
+{
+    uint16_t x1, y1, x2, y2;
+    if (not update(x1, y1, x2, y2))
+    {
+        return false;
+    }
+
+    w_screen->flush();
+    return true;
+}
+
+void hV_Widgets::getWidgetsCounters(uint32_t & drawn, uint32_t & skipped)
+{
+    drawn = w_countDrawn;
+    skipped = w_countSkipped;
+}
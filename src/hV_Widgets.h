@@ -0,0 +1,276 @@
+///
+/// @file hV_Widgets.h
+/// @brief Retained widgets with damage tracking
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 17 Oct 2026
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2026
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+#ifndef hV_WIDGETS_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_WIDGETS_RELEASE 830
+
+// Other libraries
+#include "hV_Screen_Buffer.h"
+
+// Checks
+#if (hV_SCREEN_BUFFER_RELEASE < 830)
+#error Required hV_SCREEN_BUFFER_RELEASE 830
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+///
+/// @name Widget types
+/// @{
+#define WIDGET_NONE 0x00 ///< free slot
+#define WIDGET_LABEL 0x01 ///< text
+#define WIDGET_NUMBER 0x02 ///< fixed-point number
+#define WIDGET_BAR 0x03 ///< horizontal or vertical bar
+#define WIDGET_ICON 0x04 ///< bitmap selected among frames
+/// @}
+
+#define WIDGET_ERROR 0xff ///< handle, no widget added
+#define WIDGET_TEXT 15 ///< maximum number of characters for labels and numbers
+
+///
+/// @brief Widget
+/// @details Bounding box and value, with the value last drawn
+/// @note Storage provided by the caller with hV_Widgets::begin()
+///
+struct widget_s
+{
+    uint8_t type; ///< WIDGET_NONE to WIDGET_ICON
+    uint8_t orientation; ///< orientation when added
+    uint8_t font; ///< label and number
+    uint8_t length; ///< label and number, characters; icon, number of frames
+    uint8_t decimals; ///< number
+    uint16_t x1, y1, x2, y2; ///< bounding box, included
+    uint16_t colour, backColour; ///< 16-bit colours
+    int32_t value; ///< number, bar position, icon frame
+    int32_t minimum, maximum; ///< bar
+    int32_t last; ///< bar position, icon frame, last drawn
+    const uint8_t * bitmap; ///< icon, frames of 1-bit rows, MSB first
+    char text[WIDGET_TEXT + 1]; ///< label and number, current
+    char drawn[WIDGET_TEXT + 1]; ///< label and number, last drawn
+    bool flagDrawn; ///< drawn at least once
+};
+
+///
+/// @brief Retained widgets
+/// @details Labels, numbers, bars and icons keep their bounding box and last value.
+/// update() draws only the widgets whose value has changed, and only the changed
+/// characters or the changed part of a bar, and returns the union damage rectangle.
+/// @note Same fonts and orientations as the screen
+///
+class hV_Widgets
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_Widgets(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Initialisation
+    /// @param buffer caller-provided storage for the widgets
+    /// @param number number of widgets in the buffer
+    /// @note Widgets cleared
+    ///
+    void begin(widget_s * buffer, uint8_t number);
+
+    ///
+    /// @brief Add a label
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text initial text
+    /// @param length number of characters, 1 to WIDGET_TEXT
+    /// @param colour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @return handle, WIDGET_ERROR if full or if length is 0
+    /// @note Selected font and current orientation
+    ///
+    uint8_t addLabel(uint16_t x0, uint16_t y0, String text, uint8_t length,
+                     uint16_t colour = myColours.black,
+                     uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Add a fixed-point number
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param length number of characters, 1 to WIDGET_TEXT
+    /// @param decimals number of decimals, value 1234 with 2 decimals = 12.34
+    /// @param colour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @return handle, WIDGET_ERROR if full or if length is 0
+    /// @note Right-aligned, selected font and current orientation
+    ///
+    uint8_t addNumber(uint16_t x0, uint16_t y0, uint8_t length, uint8_t decimals = 0,
+                      uint16_t colour = myColours.black,
+                      uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Add a bar, rectangle coordinates
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param minimum value for an empty bar
+    /// @param maximum value for a full bar
+    /// @param colour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @return handle, WIDGET_ERROR if full
+    /// @note Horizontal from left to right if wider than high, vertical from bottom to top otherwise
+    ///
+    uint8_t addBar(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                   int32_t minimum, int32_t maximum,
+                   uint16_t colour = myColours.black,
+                   uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Add an icon
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param width width of the icon, in pixels
+    /// @param height height of the icon, in pixels
+    /// @param bitmap frames of height rows, each row (width + 7) / 8 bytes, MSB first
+    /// @param frames number of frames
+    /// @param colour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @return handle, WIDGET_ERROR if full
+    ///
+    uint8_t addIcon(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height,
+                    const uint8_t * bitmap, uint8_t frames,
+                    uint16_t colour = myColours.black,
+                    uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Set the text of a label
+    /// @param handle handle of the label
+    /// @param text text, truncated to the length of the label
+    ///
+    void setText(uint8_t handle, String text);
+
+    ///
+    /// @brief Set the value of a number, a bar or an icon
+    /// @param handle handle of the widget
+    /// @param value number, bar value, icon frame
+    /// @note Bar value constrained to minimum..maximum, icon frame to 0..frames-1
+    ///
+    void setValue(uint8_t handle, int32_t value);
+
+    ///
+    /// @brief Get the value of a number, a bar or an icon
+    /// @param handle handle of the widget
+    /// @return value
+    ///
+    int32_t getValue(uint8_t handle);
+
+    ///
+    /// @brief Draw all the widgets again on next update()
+    /// @note Required after clear()
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Draw the widgets changed since last update()
+    /// @param[out] x1 top left coordinate, x-axis
+    /// @param[out] y1 top left coordinate, y-axis
+    /// @param[out] x2 bottom right coordinate, x-axis
+    /// @param[out] y2 bottom right coordinate, y-axis
+    /// @return true if a widget has been drawn, false otherwise
+    /// @note Damage coordinates for the current orientation, as getDirtyArea(), unchanged if nothing drawn
+    /// @n @b More: @ref Coordinate
+    ///
+    bool update(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2);
+
+    ///
+    /// @brief Draw the widgets changed since last update() and update the screen
+    /// @return true if the screen has been updated, false otherwise
+    /// @note The screen is not updated if no widget has changed
+    ///
+    bool flush();
+
+    ///
+    /// @brief Get counters
+    /// @param[out] drawn number of widgets drawn
+    /// @param[out] skipped number of widgets skipped, unchanged
+    ///
+    void getWidgetsCounters(uint32_t & drawn, uint32_t & skipped);
+
+  private:
+    /// @cond
+    ///
+    /// @brief Add a widget
+    /// @return handle, WIDGET_ERROR if full
+    ///
+    uint8_t w_add(uint8_t type);
+
+    ///
+    /// @brief Format a number into text
+    ///
+    void w_formatNumber(widget_s * widget);
+
+    ///
+    /// @brief Draw the changed characters of a label or a number
+    ///
+    bool w_drawText(widget_s * widget);
+
+    ///
+    /// @brief Draw the changed part of a bar
+    ///
+    bool w_drawBar(widget_s * widget);
+
+    ///
+    /// @brief Draw the frame of an icon
+    ///
+    bool w_drawIcon(widget_s * widget);
+
+    ///
+    /// @brief Add a rectangle to the damage, coordinates of the widget orientation
+    ///
+    void w_addDamage(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+    hV_Screen_Buffer * w_screen;
+    widget_s * w_widgets;
+    uint8_t w_number;
+    uint16_t w_damageX1, w_damageY1, w_damageX2, w_damageY2;
+    bool w_flagDamage;
+    uint32_t w_countDrawn, w_countSkipped;
+    /// @endcond
+};
+
+#endif // hV_WIDGETS_RELEASE